@@ -1,9 +1,32 @@
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <compare>
+#include <condition_variable>
+#include <exception>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <type_traits>
 #include <vector>
 
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define BIGINT_X86_SIMD
+#endif
+
 enum class Sign {
   Positive,
   Negative,
@@ -22,946 +45,5880 @@ Sign operator*(Sign a, Sign b) {
   return Sign::Negative;
 }
 
-class Rational;
+template <typename T, size_t InlineCapacity, typename Allocator = std::allocator<T>>
+class LimbBuffer {
+private:
+  using traits_type = std::allocator_traits<Allocator>;
 
-class BigInteger;
+  [[no_unique_address]] Allocator allocator_;
+  T* storage_ = inline_;
+  T* data_ = inline_;
+  size_t size_ = 0;
+  size_t capacity_ = InlineCapacity;
+  T inline_[InlineCapacity];
 
-bool operator<(const BigInteger& that, const BigInteger& other);
+  bool isInline() const;
 
-bool operator==(const BigInteger& that, const BigInteger& other);
+  size_t headroom() const;
 
-BigInteger operator-(int, const BigInteger&);
+  void reallocate(size_t capacity, size_t offset);
 
-class BigInteger {
-private:
-  Sign sign_ = Sign::Zero;
-  size_t digit_cnt_;
-  std::vector<long long> digits_;
+  void grow(size_t count);
 
-  void swap(BigInteger& other);
+  void release();
 
-  void updateOneDigitSimple(size_t index);
+  void stealFrom(LimbBuffer& other);
 
-  void updateDigitsSimple(size_t begin);
+public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using iterator = T*;
+  using const_iterator = const T*;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
-  void updateDigits(size_t begin);
+  LimbBuffer() = default;
 
-  void updateDigitsBack(size_t begin);
+  explicit LimbBuffer(const Allocator& allocator);
 
-  void updateDigitsDeleteEmpty();
+  LimbBuffer(const T* first, const T* last);
 
-  long long getHighDigit() const;
+  LimbBuffer(const LimbBuffer& other);
 
-  static long long ratioBinarySearch(const BigInteger& first, const BigInteger& second);
+  LimbBuffer(LimbBuffer&& other) noexcept;
 
-  static void addZerosToSymbol(std::string& symbol);
+  LimbBuffer& operator=(const LimbBuffer& other);
 
-  static BigInteger divisionPositive(BigInteger& dividend, const BigInteger& divisor);
+  LimbBuffer& operator=(LimbBuffer&& other) noexcept(
+      traits_type::propagate_on_container_move_assignment::value || traits_type::is_always_equal::value);
 
-  static Sign signProduct(const BigInteger& first, const BigInteger& second);
+  ~LimbBuffer();
 
-  static BigInteger gcd(const BigInteger& first, const BigInteger& second);
+  Allocator get_allocator() const;
 
-  size_t makeGreaterThan(const BigInteger& other);
+  T* data();
 
-  std::string toFullString() const;
+  const T* data() const;
 
-  void inverse();
+  size_t size() const;
 
-  bool isZero() const;
+  size_t capacity() const;
 
-  bool isPositive() const;
+  T& operator[](size_t index);
 
-  bool isNegative() const;
+  const T& operator[](size_t index) const;
 
-  friend class Rational;
-  friend bool operator<(const BigInteger&, const BigInteger&);
-  friend bool operator==(const BigInteger&, const BigInteger&);
-  friend BigInteger operator-(int, const BigInteger&);
+  iterator begin();
 
-public:
-  static const long long base = 1e9;
-  static const size_t base_power = 9;
+  const_iterator begin() const;
 
-  ~BigInteger() = default;
+  iterator end();
 
-  BigInteger() = default;
+  const_iterator end() const;
 
-  BigInteger& operator=(const BigInteger& source) = default;
+  reverse_iterator rbegin();
 
-  BigInteger(const BigInteger& source) = default;
+  const_reverse_iterator rbegin() const;
 
-  BigInteger(int source);
+  reverse_iterator rend();
 
-  size_t getDigitCount() const;
+  const_reverse_iterator rend() const;
 
-  const std::vector<long long>& getDigits() const;
+  void reserve(size_t capacity);
 
-  explicit BigInteger(long long source);
+  void resize(size_t count, T value = T());
 
-  explicit BigInteger(const std::string& source);
+  void assign(const T* first, const T* last);
 
-  explicit operator bool() const;
+  void clear();
 
-  std::string toString() const;
+  void push_back(T value);
 
-  BigInteger operator-() const;
+  void pop_back();
 
-  BigInteger& operator+=(const BigInteger& other);
+  iterator erase(iterator first, iterator last);
 
-  BigInteger& operator+=(long long other);
+  iterator insert(iterator position, size_t count, T value);
 
-  BigInteger operator++(int);
+  void swap(LimbBuffer& other);
+};
 
-  BigInteger& operator++();
+template <typename T, size_t InlineCapacity, typename Allocator>
+bool LimbBuffer<T, InlineCapacity, Allocator>::isInline() const {
+  return storage_ == inline_;
+}
 
-  BigInteger operator--(int);
+template <typename T, size_t InlineCapacity, typename Allocator>
+size_t LimbBuffer<T, InlineCapacity, Allocator>::headroom() const {
+  return data_ - storage_;
+}
 
-  BigInteger& operator--();
+template <typename T, size_t InlineCapacity, typename Allocator>
+void LimbBuffer<T, InlineCapacity, Allocator>::reallocate(size_t capacity, size_t offset) {
+  T* storage = traits_type::allocate(allocator_, capacity);
+  std::copy(data_, data_ + size_, storage + offset);
+  release();
+  storage_ = storage;
+  data_ = storage + offset;
+  capacity_ = capacity;
+}
 
-  BigInteger& operator-=(const BigInteger& other);
+template <typename T, size_t InlineCapacity, typename Allocator>
+void LimbBuffer<T, InlineCapacity, Allocator>::grow(size_t count) {
+  if (count > capacity()) {
+    reallocate(std::max(headroom() + count, 2 * capacity_), headroom());
+  }
+}
 
-  BigInteger& operator*=(const BigInteger& other);
+template <typename T, size_t InlineCapacity, typename Allocator>
+void LimbBuffer<T, InlineCapacity, Allocator>::release() {
+  if (!isInline()) {
+    traits_type::deallocate(allocator_, storage_, capacity_);
+  }
 
-  BigInteger& operator*=(long long other);
+  storage_ = inline_;
+  data_ = inline_;
+  capacity_ = InlineCapacity;
+}
 
-  BigInteger& operator<<(size_t value);
+template <typename T, size_t InlineCapacity, typename Allocator>
+void LimbBuffer<T, InlineCapacity, Allocator>::stealFrom(LimbBuffer& other) {
+  if (other.isInline()) {
+    std::copy(other.data_, other.data_ + other.size_, inline_);
+  } else {
+    storage_ = other.storage_;
+    data_ = other.data_;
+    capacity_ = other.capacity_;
+    other.storage_ = other.inline_;
+    other.data_ = other.inline_;
+    other.capacity_ = InlineCapacity;
+  }
 
-  BigInteger& operator/=(const BigInteger& other);
+  size_ = other.size_;
+  other.size_ = 0;
+}
 
-  BigInteger& operator%=(const BigInteger& other);
-};
+template <typename T, size_t InlineCapacity, typename Allocator>
+LimbBuffer<T, InlineCapacity, Allocator>::LimbBuffer(const Allocator& allocator) : allocator_(allocator) {}
 
+template <typename T, size_t InlineCapacity, typename Allocator>
+LimbBuffer<T, InlineCapacity, Allocator>::LimbBuffer(const T* first, const T* last) {
+  assign(first, last);
+}
 
-bool operator<(const BigInteger& that, const BigInteger& other);
+template <typename T, size_t InlineCapacity, typename Allocator>
+LimbBuffer<T, InlineCapacity, Allocator>::LimbBuffer(const LimbBuffer& other)
+    : allocator_(traits_type::select_on_container_copy_construction(other.allocator_)) {
+  assign(other.data_, other.data_ + other.size_);
+}
 
-bool operator==(const BigInteger& that, const BigInteger& other);
+template <typename T, size_t InlineCapacity, typename Allocator>
+LimbBuffer<T, InlineCapacity, Allocator>::LimbBuffer(LimbBuffer&& other) noexcept
+    : allocator_(other.allocator_) {
+  stealFrom(other);
+}
 
-bool operator>(const BigInteger& that, const BigInteger& other);
+template <typename T, size_t InlineCapacity, typename Allocator>
+LimbBuffer<T, InlineCapacity, Allocator>&
+LimbBuffer<T, InlineCapacity, Allocator>::operator=(const LimbBuffer& other) {
+  if (this == &other) {
+    return *this;
+  }
 
-bool operator>=(const BigInteger& that, const BigInteger& other);
+  if constexpr (traits_type::propagate_on_container_copy_assignment::value) {
+    if (allocator_ != other.allocator_) {
+      release();
+    }
 
-bool operator<=(const BigInteger& that, const BigInteger& other);
+    allocator_ = other.allocator_;
+  }
 
-void BigInteger::swap(BigInteger& other) {
-  std::swap(sign_, other.sign_);
-  std::swap(digit_cnt_, other.digit_cnt_);
-  std::swap(digits_, other.digits_);
+  assign(other.data_, other.data_ + other.size_);
+  return *this;
 }
 
-void BigInteger::updateOneDigitSimple(size_t index) {
-  if (digits_[index] >= base) {
+template <typename T, size_t InlineCapacity, typename Allocator>
+LimbBuffer<T, InlineCapacity, Allocator>&
+LimbBuffer<T, InlineCapacity, Allocator>::operator=(LimbBuffer&& other) noexcept(
+    traits_type::propagate_on_container_move_assignment::value || traits_type::is_always_equal::value) {
+  if (this == &other) {
+    return *this;
+  }
+
+  if constexpr (traits_type::propagate_on_container_move_assignment::value) {
 
-    if (index + 1 == digit_cnt_) {
-      digits_.push_back(0);
-      ++digit_cnt_;
-    }
+    release();
+    allocator_ = other.allocator_;
+    stealFrom(other);
+
+  } else {
 
-    ++digits_[index + 1];
-    digits_[index] -= base;
+    if (allocator_ == other.allocator_) {
+      release();
+      stealFrom(other);
+    } else {
+      assign(other.data_, other.data_ + other.size_);
+    }
   }
+
+  return *this;
 }
 
-void BigInteger::updateDigitsSimple(size_t begin) {
-  size_t index = begin;
+template <typename T, size_t InlineCapacity, typename Allocator>
+LimbBuffer<T, InlineCapacity, Allocator>::~LimbBuffer() {
+  release();
+}
 
-  while (index < digit_cnt_ - 1 && digits_[index] >= base) {
-    ++digits_[index + 1];
-    digits_[index] -= base;
-    ++index;
-  }
+template <typename T, size_t InlineCapacity, typename Allocator>
+Allocator LimbBuffer<T, InlineCapacity, Allocator>::get_allocator() const {
+  return allocator_;
+}
 
-  if (digits_[index] >= base) {
-    digits_[index] -= base;
-    digits_.push_back(1ll);
-  }
+template <typename T, size_t InlineCapacity, typename Allocator>
+T* LimbBuffer<T, InlineCapacity, Allocator>::data() {
+  return data_;
 }
 
-void BigInteger::updateDigits(size_t begin) {
-  for (size_t index = begin; index < digit_cnt_ - 1; ++index) {
+template <typename T, size_t InlineCapacity, typename Allocator>
+const T* LimbBuffer<T, InlineCapacity, Allocator>::data() const {
+  return data_;
+}
 
-    if (digits_[index] >= base) {
-      long long temp = digits_[index] / base;
-      digits_[index + 1] += temp;
-      digits_[index] -= temp * base;
-    }
+template <typename T, size_t InlineCapacity, typename Allocator>
+size_t LimbBuffer<T, InlineCapacity, Allocator>::size() const {
+  return size_;
+}
 
-  }
+template <typename T, size_t InlineCapacity, typename Allocator>
+size_t LimbBuffer<T, InlineCapacity, Allocator>::capacity() const {
+  return capacity_ - headroom();
+}
 
-  if (getHighDigit() >= base) {
-    long long temp = getHighDigit() / base;
-    digits_.push_back(temp);
-    digits_[digit_cnt_ - 1] -= temp * base;
-    ++digit_cnt_;
-  }
+template <typename T, size_t InlineCapacity, typename Allocator>
+T& LimbBuffer<T, InlineCapacity, Allocator>::operator[](size_t index) {
+  return data_[index];
+}
+
+template <typename T, size_t InlineCapacity, typename Allocator>
+const T& LimbBuffer<T, InlineCapacity, Allocator>::operator[](size_t index) const {
+  return data_[index];
 }
 
-void BigInteger::updateDigitsBack(size_t begin) {
-  if (digits_[begin] < 0) {
+template <typename T, size_t InlineCapacity, typename Allocator>
+typename LimbBuffer<T, InlineCapacity, Allocator>::iterator LimbBuffer<T, InlineCapacity, Allocator>::begin() {
+  return data_;
+}
 
-    size_t index = begin + 1;
+template <typename T, size_t InlineCapacity, typename Allocator>
+typename LimbBuffer<T, InlineCapacity, Allocator>::const_iterator
+LimbBuffer<T, InlineCapacity, Allocator>::begin() const {
+  return data_;
+}
 
-    while (digits_[index] == 0) {
-     ++index;
-    }
+template <typename T, size_t InlineCapacity, typename Allocator>
+typename LimbBuffer<T, InlineCapacity, Allocator>::iterator LimbBuffer<T, InlineCapacity, Allocator>::end() {
+  return data_ + size_;
+}
 
-    --digits_[index];
+template <typename T, size_t InlineCapacity, typename Allocator>
+typename LimbBuffer<T, InlineCapacity, Allocator>::const_iterator LimbBuffer<T, InlineCapacity, Allocator>::end() const {
+  return data_ + size_;
+}
 
-    if (digits_[index] == 0 && index + 1 == digit_cnt_) {
-      digits_.pop_back();
-      --digit_cnt_;
-    }
+template <typename T, size_t InlineCapacity, typename Allocator>
+typename LimbBuffer<T, InlineCapacity, Allocator>::reverse_iterator LimbBuffer<T, InlineCapacity, Allocator>::rbegin() {
+  return reverse_iterator(end());
+}
 
-    digits_[--index] += base;
+template <typename T, size_t InlineCapacity, typename Allocator>
+typename LimbBuffer<T, InlineCapacity, Allocator>::const_reverse_iterator
+LimbBuffer<T, InlineCapacity, Allocator>::rbegin() const {
+  return const_reverse_iterator(end());
+}
 
-    while (index > begin) {
-      --digits_[index--];
-      digits_[index] += base;
-    }
+template <typename T, size_t InlineCapacity, typename Allocator>
+typename LimbBuffer<T, InlineCapacity, Allocator>::reverse_iterator LimbBuffer<T, InlineCapacity, Allocator>::rend() {
+  return reverse_iterator(begin());
+}
+
+template <typename T, size_t InlineCapacity, typename Allocator>
+typename LimbBuffer<T, InlineCapacity, Allocator>::const_reverse_iterator
+LimbBuffer<T, InlineCapacity, Allocator>::rend() const {
+  return const_reverse_iterator(begin());
+}
+
+template <typename T, size_t InlineCapacity, typename Allocator>
+void LimbBuffer<T, InlineCapacity, Allocator>::reserve(size_t capacity) {
+  if (capacity > this->capacity()) {
+    reallocate(headroom() + capacity, headroom());
   }
 }
-void BigInteger::updateDigitsDeleteEmpty() {
-  if (digit_cnt_ <= 0) {
-    return;
+
+template <typename T, size_t InlineCapacity, typename Allocator>
+void LimbBuffer<T, InlineCapacity, Allocator>::resize(size_t count, T value) {
+  grow(count);
+
+  if (count > size_) {
+    std::fill(data_ + size_, data_ + count, value);
   }
 
-  size_t index = digit_cnt_ - 1;
+  size_ = count;
+}
 
-  while (digits_[index] == 0) {
-    digits_.pop_back();
-    --digit_cnt_;
+template <typename T, size_t InlineCapacity, typename Allocator>
+void LimbBuffer<T, InlineCapacity, Allocator>::assign(const T* first, const T* last) {
+  size_t count = last - first;
+  size_ = 0;
+  data_ = storage_;
+  reserve(count);
+  std::copy(first, last, data_);
+  size_ = count;
+}
 
-    if (index == 0) {
-      sign_ = Sign::Negative;
-      break;
-    }
+template <typename T, size_t InlineCapacity, typename Allocator>
+void LimbBuffer<T, InlineCapacity, Allocator>::clear() {
+  size_ = 0;
+}
 
-    --index;
-  }
+template <typename T, size_t InlineCapacity, typename Allocator>
+void LimbBuffer<T, InlineCapacity, Allocator>::push_back(T value) {
+  grow(size_ + 1);
+  data_[size_++] = value;
 }
 
-long long BigInteger::getHighDigit() const {
-  if (isZero()) {
-    return 0;
+template <typename T, size_t InlineCapacity, typename Allocator>
+void LimbBuffer<T, InlineCapacity, Allocator>::pop_back() {
+  --size_;
+}
+
+template <typename T, size_t InlineCapacity, typename Allocator>
+typename LimbBuffer<T, InlineCapacity, Allocator>::iterator
+LimbBuffer<T, InlineCapacity, Allocator>::erase(iterator first, iterator last) {
+  if (first == data_) {
+    size_ -= last - first;
+    data_ = last;
+    return data_;
   }
 
-  return digits_[digit_cnt_ - 1];
+  std::copy(last, end(), first);
+  size_ -= last - first;
+  return first;
 }
 
-long long BigInteger::ratioBinarySearch(const BigInteger& first, const BigInteger& second) {
-  if (second.sign_ == Sign::Negative) {
-    return -1;
-  }
+template <typename T, size_t InlineCapacity, typename Allocator>
+typename LimbBuffer<T, InlineCapacity, Allocator>::iterator
+LimbBuffer<T, InlineCapacity, Allocator>::insert(iterator position, size_t count, T value) {
+  size_t index = position - data_;
 
-  if (first.sign_ * second.sign_ == Sign::Negative || first.sign_ == Sign::Negative) {
-    return -1;
-  }
+  if (index == 0) {
+    if (count > headroom()) {
+      reallocate(2 * (size_ + count), size_ + count);
+    }
 
-  if (second > first) {
-    return 0;
+    data_ -= count;
+    std::fill(data_, data_ + count, value);
+    size_ += count;
+    return data_;
   }
 
-  if (second == first) {
-    return 1;
-  }
+  grow(size_ + count);
+  std::copy_backward(data_ + index, data_ + size_, data_ + size_ + count);
+  std::fill(data_ + index, data_ + index + count, value);
+  size_ += count;
+  return data_ + index;
+}
 
-  long long ratio_max = base + 1;
-  long long ratio_min = 1;
-  long long ratio_mid;
-  BigInteger temp;
+template <typename T, size_t InlineCapacity, typename Allocator>
+void LimbBuffer<T, InlineCapacity, Allocator>::swap(LimbBuffer& other) {
+  LimbBuffer temp(std::move(other));
+  other = std::move(*this);
+  *this = std::move(temp);
+}
 
-  while (ratio_min < ratio_max - 1) {
-    ratio_mid = (ratio_max + ratio_min) / 2;
-    temp = second;
-    temp *= ratio_mid;
+class LimbArena {
+private:
+  struct Block {
+    char* memory;
+    size_t size;
+    bool owned;
+  };
 
-    if (temp <= first) {
+  std::vector<Block> blocks_;
+  size_t block_size_;
+  size_t block_ = 0;
+  size_t offset_ = 0;
 
-      ratio_min = ratio_mid;
+public:
+  explicit LimbArena(size_t block_size = 1 << 16);
 
-    } else {
+  LimbArena(void* memory, size_t size, size_t block_size = 1 << 16);
 
-      ratio_max = ratio_mid;
+  template <typename Storage>
+  LimbArena(Storage& storage, size_t size, size_t block_size = 1 << 16);
 
-    }
+  LimbArena(const LimbArena&) = delete;
+
+  LimbArena& operator=(const LimbArena&) = delete;
+
+  ~LimbArena();
+
+  void* allocate(size_t bytes, size_t alignment);
+
+  void reset();
+
+  size_t used() const;
+
+  static LimbArena*& current();
+};
+
+LimbArena::LimbArena(size_t block_size) : block_size_(block_size) {}
+
+LimbArena::LimbArena(void* memory, size_t size, size_t block_size) : block_size_(block_size) {
+  blocks_.push_back({static_cast<char*>(memory), size, false});
+}
+
+template <typename Storage>
+LimbArena::LimbArena(Storage& storage, size_t size, size_t block_size)
+    : LimbArena(storage.takeMem(size, alignof(std::max_align_t)), size, block_size) {
+  if (blocks_.back().memory == nullptr) {
+    throw std::bad_alloc();
   }
-  return ratio_min;
 }
 
-void BigInteger::addZerosToSymbol(std::string& symbol) {
-  if (symbol.size() < base_power) {
-    symbol = std::string(base_power - symbol.size(), '0') + symbol;
+LimbArena::~LimbArena() {
+  for (Block& block : blocks_) {
+    if (block.owned) {
+      delete[] block.memory;
+    }
   }
 }
 
-BigInteger BigInteger::gcd(const BigInteger& first, const BigInteger& second) {
-  BigInteger first_temp(first);
-  BigInteger second_temp(second);
-  BigInteger temp;
+void* LimbArena::allocate(size_t bytes, size_t alignment) {
+  while (true) {
+    if (block_ == blocks_.size()) {
+      size_t size = std::max(bytes + alignment, blocks_.empty() ? block_size_ : 2 * blocks_.back().size);
+      blocks_.push_back({new char[size], size, true});
+    }
 
-  if (!first_temp.isPositive() || !second_temp.isPositive()) {
-    std::cerr << "GCD wrong sign_s" << std::endl;
-    return temp;
-  }
+    void* position = blocks_[block_].memory + offset_;
+    size_t space = blocks_[block_].size - offset_;
 
-  while (second_temp.isPositive()) {
-    temp = second_temp;
-    second_temp = first_temp %= second_temp;
-    second_temp.updateDigitsDeleteEmpty();
-    first_temp = temp;
-  }
+    if (std::align(alignment, bytes, position, space) != nullptr) {
+      offset_ = static_cast<char*>(position) - blocks_[block_].memory + bytes;
+      return position;
+    }
 
-  return first_temp;
+    ++block_;
+    offset_ = 0;
+  }
 }
 
-BigInteger BigInteger::divisionPositive(BigInteger& dividend, const BigInteger& divisor) {
-  BigInteger divisor_temp(divisor);
-  std::vector<long long> reverse_answer;
+void LimbArena::reset() {
+  block_ = 0;
+  offset_ = 0;
+}
 
-  BigInteger dividend_temp;
-  dividend_temp.sign_ = Sign::Positive;
+size_t LimbArena::used() const {
+  size_t result = offset_;
 
-  for (size_t index = dividend.digit_cnt_ - divisor.digit_cnt_; index < dividend.digit_cnt_; ++index) {
-    dividend_temp.digits_.push_back(dividend.digits_[index]);
+  for (size_t index = 0; index < block_ && index < blocks_.size(); ++index) {
+    result += blocks_[index].size;
   }
 
-  dividend_temp.digit_cnt_ = divisor.digit_cnt_;
-  long long temp_ans = ratioBinarySearch(dividend_temp, divisor_temp);
-  reverse_answer.push_back(temp_ans);
+  return result;
+}
+
+LimbArena*& LimbArena::current() {
+  thread_local LimbArena* arena = nullptr;
+  return arena;
+}
 
-  divisor_temp *= temp_ans;
-  dividend_temp -= divisor_temp;
+class ArenaScope {
+private:
+  LimbArena* previous_;
 
-  for (size_t index = dividend.digit_cnt_ - divisor.digit_cnt_; index > 0; --index) {
-    divisor_temp = divisor;
-    dividend_temp << static_cast<size_t>(1);
-    dividend_temp += dividend.digits_[index - 1];
+public:
+  explicit ArenaScope(LimbArena& arena);
 
-    temp_ans = ratioBinarySearch(dividend_temp, divisor_temp);
+  ArenaScope(const ArenaScope&) = delete;
 
-    reverse_answer.push_back(temp_ans);
-    divisor_temp *= temp_ans;
-    dividend_temp -= divisor_temp;
-    dividend_temp.updateDigitsDeleteEmpty();
-  }
+  ArenaScope& operator=(const ArenaScope&) = delete;
 
-  std::reverse(reverse_answer.begin(), reverse_answer.end());
-  dividend.digits_ = reverse_answer;
-  dividend.digit_cnt_ = reverse_answer.size();
-  dividend.updateDigitsDeleteEmpty();
+  ~ArenaScope();
+};
 
-  return dividend_temp;
+ArenaScope::ArenaScope(LimbArena& arena) : previous_(LimbArena::current()) {
+  LimbArena::current() = &arena;
 }
 
-Sign BigInteger::signProduct(const BigInteger& first, const BigInteger& second) {
-  return first.sign_ * second.sign_;
+ArenaScope::~ArenaScope() {
+  LimbArena::current() = previous_;
 }
 
-BigInteger::BigInteger(int source): sign_(Sign::Zero), digit_cnt_(0) {
-  if (source > 0) {
+// Like std::pmr::polymorphic_allocator, the arena is not propagated on copy,
+// move assignment or swap: assigning into a value keeps that value's storage.
+// A value move-constructed from an arena temporary takes over its limbs and
+// so lives only as long as the arena's current contents.
+template <typename T>
+class ArenaAllocator {
+private:
+  LimbArena* arena_ = LimbArena::current();
 
-    sign_ = Sign::Positive;
+public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_move_assignment = std::false_type;
+  using propagate_on_container_swap = std::false_type;
+  using is_always_equal = std::false_type;
 
-  } else if (source < 0) {
+  ArenaAllocator() = default;
 
-    sign_ = Sign::Negative;
+  explicit ArenaAllocator(LimbArena* arena);
 
-  } else {
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U>& other);
 
-    return;
+  T* allocate(size_t count) const;
 
-  }
+  void deallocate(T* pointer, size_t count) const;
 
-  digit_cnt_ = abs(source) >= base ? 2 : 1;
-  int temp = abs(source);
+  ArenaAllocator select_on_container_copy_construction() const;
 
-  long long digit_first = temp % base;
-  digits_.push_back(digit_first);
-  long long digit_second = (temp - digit_first) / base;
+  LimbArena* arena() const;
 
-  if (digit_second) {
-    digits_.push_back(digit_second);
-  }
-}
+  template <typename U>
+  bool operator==(const ArenaAllocator<U>& other) const;
+};
 
-void BigInteger::inverse() {
-  if (sign_ == Sign::Positive) {
+template <typename T>
+ArenaAllocator<T>::ArenaAllocator(LimbArena* arena) : arena_(arena) {}
 
-    sign_ = Sign::Negative;
+template <typename T>
+template <typename U>
+ArenaAllocator<T>::ArenaAllocator(const ArenaAllocator<U>& other) : arena_(other.arena()) {}
 
-  } else if (sign_ == Sign::Negative) {
+template <typename T>
+T* ArenaAllocator<T>::allocate(size_t count) const {
+  if (arena_ == nullptr) {
+    return std::allocator<T>().allocate(count);
+  }
 
-    sign_ = Sign::Positive;
+  return static_cast<T*>(arena_->allocate(count * sizeof(T), alignof(T)));
+}
 
+template <typename T>
+void ArenaAllocator<T>::deallocate(T* pointer, size_t count) const {
+  if (arena_ == nullptr) {
+    std::allocator<T>().deallocate(pointer, count);
   }
 }
 
-size_t BigInteger::getDigitCount() const {
-  return digit_cnt_;
+template <typename T>
+ArenaAllocator<T> ArenaAllocator<T>::select_on_container_copy_construction() const {
+  return ArenaAllocator();
 }
 
-const std::vector<long long>& BigInteger::getDigits() const {
-  return digits_;
+template <typename T>
+LimbArena* ArenaAllocator<T>::arena() const {
+  return arena_;
 }
 
-bool BigInteger::isZero() const {
-  return sign_ == Sign::Zero;
+template <typename T>
+template <typename U>
+bool ArenaAllocator<T>::operator==(const ArenaAllocator<U>& other) const {
+  return arena_ == other.arena();
 }
 
-bool BigInteger::isPositive() const {
-  return sign_ == Sign::Positive;
-}
+struct DecimalLimbs {
+  using limb_type = long long;
+  using allocator_type = std::allocator<limb_type>;
 
-bool BigInteger::isNegative() const {
-  return sign_ == Sign::Negative;
-}
+  static const long long radix = 10;
+  static const size_t base_power = 9;
+  static const size_t decimal_width = 9;
+  static const size_t inline_capacity = 2;
+  static const long long base = 1e9;
+  static const long long transform_base = 1e9;
+  static const size_t transform_split = 1;
+  static const size_t transform_threshold = 1000;
+};
 
-BigInteger::BigInteger(long long source): sign_(Sign::Zero), digit_cnt_(0) {
-  if (source > 0) {
+struct BinaryLimbs {
+  using limb_type = unsigned int;
+  using allocator_type = std::allocator<limb_type>;
+
+  static const long long radix = 2;
+  static const size_t base_power = 32;
+  static const size_t decimal_width = 10;
+  static const size_t inline_capacity = 4;
+  static const long long base = 1ll << 32;
+  static const long long transform_base = 1ll << 16;
+  static const size_t transform_split = 2;
+  static const size_t transform_threshold = 12000;
+};
 
-    sign_ = Sign::Positive;
+template <typename Limbs, typename Allocator>
+struct AllocatedLimbs : Limbs {
+  using allocator_type = Allocator;
+};
 
-  } else if (source < 0) {
+template <typename Limbs>
+using ArenaLimbs = AllocatedLimbs<Limbs, ArenaAllocator<typename Limbs::limb_type>>;
 
-    sign_ = Sign::Negative;
+namespace bigint::parallel {
 
-  } else {
+class WorkerPool {
+private:
+  struct Batch {
+    const std::function<void(size_t)>* function;
+    size_t count;
+    size_t limit;
+    size_t next = 0;
+    size_t done = 0;
+    size_t helpers = 0;
+    std::exception_ptr error;
+  };
 
-    return;
+  std::mutex mutex_;
+  std::condition_variable work_;
+  std::condition_variable finished_;
+  std::vector<Batch*> batches_;
+  std::vector<std::thread> threads_;
+  bool stopping_ = false;
+
+  WorkerPool() = default;
+
+  void reserve(size_t threads);
+
+  Batch* available() const;
+
+  void drain(Batch& batch, std::unique_lock<std::mutex>& lock);
+
+  void work();
+
+public:
+  WorkerPool(const WorkerPool&) = delete;
+
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  ~WorkerPool();
+
+  static WorkerPool& instance();
+
+  void run(size_t tasks, size_t threads, const std::function<void(size_t)>& function);
+};
+
+WorkerPool::~WorkerPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
   }
 
-  long long temp_digit;
-  long long copy = source;
+  work_.notify_all();
 
-  while (copy > 0) {
-    temp_digit = copy % base;
-    digits_.push_back(temp_digit);
-    copy -= temp_digit;
-    copy /= base;
+  for (std::thread& thread : threads_) {
+    thread.join();
   }
+}
 
-  digit_cnt_ = digits_.size();
+WorkerPool& WorkerPool::instance() {
+  static WorkerPool pool;
+  return pool;
 }
 
-BigInteger::BigInteger(const std::string& source): sign_(Sign::Zero), digit_cnt_(0) {
-  if (source.size() != 0) {
+void WorkerPool::reserve(size_t threads) {
+  if (threads_.size() >= threads) {
+    return;
+  }
 
-    size_t lower_bound = 0;
+  threads_.reserve(threads);
 
-    if (source[0] == '-') {
+  try {
+    while (threads_.size() < threads) {
+      threads_.emplace_back(&WorkerPool::work, this);
+    }
+  } catch (const std::system_error&) {
+  }
+}
 
-      sign_ = Sign::Negative;
-      lower_bound = 1;
+WorkerPool::Batch* WorkerPool::available() const {
+  for (Batch* batch : batches_) {
+    if (batch->helpers < batch->limit) {
+      return batch;
+    }
+  }
 
-    } else {
+  return nullptr;
+}
 
-      sign_ = Sign::Positive;
+void WorkerPool::drain(Batch& batch, std::unique_lock<std::mutex>& lock) {
+  while (batch.next < batch.count) {
+    size_t task = batch.next++;
+
+    if (batch.next == batch.count) {
+      batches_.erase(std::find(batches_.begin(), batches_.end(), &batch));
     }
 
-    if (source[lower_bound] == '0') {
-      *this = BigInteger();
+    lock.unlock();
+    std::exception_ptr error;
+
+    try {
+      (*batch.function)(task);
+    } catch (...) {
+      error = std::current_exception();
     }
 
-    size_t new_ind = source.size();
+    lock.lock();
 
-    for (; new_ind >= lower_bound + base_power; new_ind -= base_power) {
-      std::string substr = source.substr(new_ind - base_power, base_power);
-      digits_.push_back(std::stoll(substr));
-      ++digit_cnt_;
+    if (error && !batch.error) {
+      batch.error = error;
     }
 
-    if (new_ind != lower_bound) {
-      std::string substr = source.substr(lower_bound, new_ind - lower_bound);
-      digits_.push_back(std::stoll(substr));
-      ++digit_cnt_;
+    if (++batch.done == batch.count) {
+      finished_.notify_all();
     }
   }
 }
 
-size_t BigInteger::makeGreaterThan(const BigInteger& other) {
-  if (*this >= other) {
+void WorkerPool::work() {
+  std::unique_lock<std::mutex> lock(mutex_);
 
-    return static_cast<size_t>(0);
-  }
+  while (true) {
+    Batch* batch = nullptr;
+    work_.wait(lock, [&] { return stopping_ || (batch = available()) != nullptr; });
 
-  size_t digit_diff = other.digit_cnt_ - digit_cnt_;
-  *this << digit_diff;
+    if (batch == nullptr) {
+      return;
+    }
 
-  if (*this < other) {
-    *this << static_cast<size_t>(1);
-    ++digit_diff;
+    ++batch->helpers;
+    drain(*batch, lock);
+    --batch->helpers;
   }
-
-  return digit_diff;
-}
-
-BigInteger::operator bool() const {
-  return sign_ != Sign::Zero;
 }
 
-std::string BigInteger::toString() const {
-  if (sign_ == Sign::Zero) {
+void WorkerPool::run(size_t tasks, size_t threads, const std::function<void(size_t)>& function) {
+  if (threads == 0 || tasks <= 1) {
+    for (size_t task = 0; task < tasks; ++task) {
+      function(task);
+    }
 
-    return std::string(1, '0');
+    return;
   }
 
-  std::string result;
-  std::string str_temp;
+  Batch batch{&function, tasks, std::min(threads, tasks - 1), 0, 0, 0, nullptr};
+  std::unique_lock<std::mutex> lock(mutex_);
 
-  if (sign_ == Sign::Negative) {
-    result += '-';
+  reserve(threads);
+  batches_.push_back(&batch);
+
+  for (size_t helper = 0; helper < batch.limit; ++helper) {
+    work_.notify_one();
   }
 
-  result += std::to_string(digits_[digit_cnt_ - 1]);
+  drain(batch, lock);
+  finished_.wait(lock, [&] { return batch.done == batch.count; });
 
-  for (size_t i = digit_cnt_ - 1; i > 0; --i) {
-    str_temp = std::to_string(digits_[i - 1]);
-    addZerosToSymbol(str_temp);
-    result += str_temp;
+  if (batch.error) {
+    std::rethrow_exception(batch.error);
   }
+}
 
-  return result;
 }
 
-std::string BigInteger::toFullString() const {
-  std::string result;
+namespace bigint::simd {
 
-  if (sign_ == Sign::Zero) {
-    return result;
-  }
+enum class Level {
+  Scalar,
+  Avx2,
+  Avx512
+};
 
-  if (sign_ == Sign::Negative) {
-    result += '-';
-  }
+template <typename Limbs>
+class LimbKernels {
+private:
+  using limb_type = typename Limbs::limb_type;
+  using wide_type = unsigned long long;
 
-  for (size_t index = digit_cnt_; index > 0; --index) {
-    std::string temp(std::to_string(digits_[index - 1]));
-    addZerosToSymbol(temp);
-    result += temp;
-  }
+  static const long long base = Limbs::base;
 
-  return result;
-}
+  static Level detectLevel();
 
-BigInteger BigInteger::operator-() const {
-  BigInteger result(*this);
-  result.inverse();
-  return result;
-}
+  template <bool Subtract>
+  static wide_type combineScalar(limb_type* target, const limb_type* source, size_t count, wide_type carry);
 
-BigInteger& BigInteger::operator+=(const BigInteger& other) {
-  if (isZero()) {
+  static size_t mismatchScalar(const limb_type* first, const limb_type* second, size_t count);
 
-    *this = other;
-    return *this;
-  }
+  static void splitProductScalar(const limb_type* source, size_t count, wide_type factor,
+                                 limb_type* low, limb_type* high);
 
-  if (other.isZero()) {
-    return *this;
-  }
+#ifdef BIGINT_X86_SIMD
+  template <bool Subtract>
+  __attribute__((target("avx2")))
+  static wide_type combineAvx2(limb_type* target, const limb_type* source, size_t count, wide_type carry);
 
-  if (sign_ * other.sign_ == Sign::Positive) {
+  template <bool Subtract>
+  __attribute__((target("avx512f")))
+  static wide_type combineAvx512(limb_type* target, const limb_type* source, size_t count, wide_type carry);
 
-    if (other.digit_cnt_ > digit_cnt_) {
-       digit_cnt_ = other.digit_cnt_;
-       digits_.resize(digit_cnt_);
-    }
+  __attribute__((target("avx2")))
+  static size_t mismatchAvx2(const limb_type* first, const limb_type* second, size_t count);
 
-    for (size_t i = 0; i < std::min(other.digit_cnt_, digit_cnt_); ++i) {
-      digits_[i] += other.digits_[i];
-      updateOneDigitSimple(i);
-    }
+  __attribute__((target("avx512f")))
+  static size_t mismatchAvx512(const limb_type* first, const limb_type* second, size_t count);
 
-  } else {
+  __attribute__((target("avx2")))
+  static size_t splitProductAvx2(const limb_type* source, size_t count, wide_type factor,
+                                 limb_type* low, limb_type* high);
 
-    inverse();
+  __attribute__((target("avx512f")))
+  static size_t splitProductAvx512(const limb_type* source, size_t count, wide_type factor,
+                                   limb_type* low, limb_type* high);
+#endif
 
-    if ((*this) == other) {
-      *this = BigInteger();
-      return *this;
-    }
+public:
+  inline static Level level = detectLevel();
 
-    if ((sign_ == Sign::Negative) ^ ((*this) < other)) {
+  static wide_type add(limb_type* target, const limb_type* source, size_t count);
 
-      BigInteger temp(other);
+  static wide_type subtract(limb_type* target, const limb_type* source, size_t count);
 
-      for (size_t i = 0; i < digit_cnt_; ++i) {
-        temp.digits_[i] -= digits_[i];
-        temp.updateDigitsBack(i);
-      }
+  static int compare(const limb_type* first, const limb_type* second, size_t count);
 
-      swap(temp);
+  static void splitProduct(const limb_type* source, size_t count, wide_type factor,
+                           limb_type* low, limb_type* high);
+};
 
-    } else {
+template <typename Limbs>
+Level LimbKernels<Limbs>::detectLevel() {
+#ifdef BIGINT_X86_SIMD
+  __builtin_cpu_init();
 
-      for (size_t i = 0; i < other.digit_cnt_; ++i) {
-        digits_[i] -= other.digits_[i];
-        updateDigitsBack(i);
+  if (__builtin_cpu_supports("avx512f")) {
+    return Level::Avx512;
+  }
+
+  if (__builtin_cpu_supports("avx2")) {
+    return Level::Avx2;
+  }
+#endif
+
+  return Level::Scalar;
+}
+
+template <typename Limbs>
+template <bool Subtract>
+typename LimbKernels<Limbs>::wide_type LimbKernels<Limbs>::combineScalar(limb_type* target, const limb_type* source,
+                                                                         size_t count, wide_type carry) {
+  for (size_t index = 0; index < count; ++index) {
+    if constexpr (Subtract) {
+      wide_type current = static_cast<wide_type>(target[index]) + base - source[index] - carry;
+      carry = current < base ? 1 : 0;
+      target[index] = static_cast<limb_type>(current - (1 - carry) * base);
+    } else {
+      wide_type current = static_cast<wide_type>(target[index]) + source[index] + carry;
+      carry = current >= base ? 1 : 0;
+      target[index] = static_cast<limb_type>(current - carry * base);
+    }
+  }
+
+  return carry;
+}
+
+template <typename Limbs>
+size_t LimbKernels<Limbs>::mismatchScalar(const limb_type* first, const limb_type* second, size_t count) {
+  while (count > 0 && first[count - 1] == second[count - 1]) {
+    --count;
+  }
+
+  return count;
+}
+
+template <typename Limbs>
+void LimbKernels<Limbs>::splitProductScalar(const limb_type* source, size_t count, wide_type factor,
+                                            limb_type* low, limb_type* high) {
+  for (size_t index = 0; index < count; ++index) {
+    wide_type product = static_cast<wide_type>(source[index]) * factor;
+    high[index] = static_cast<limb_type>(product / base);
+    low[index] = static_cast<limb_type>(product % base);
+  }
+}
+
+#ifdef BIGINT_X86_SIMD
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+template <typename Limbs>
+template <bool Subtract>
+__attribute__((target("avx2")))
+typename LimbKernels<Limbs>::wide_type LimbKernels<Limbs>::combineAvx2(limb_type* target, const limb_type* source,
+                                                                       size_t count, wide_type carry) {
+  const size_t lanes = 32 / sizeof(limb_type);
+  const unsigned int full = (1u << lanes) - 1;
+  size_t index = 0;
+
+  for (; index + lanes <= count; index += lanes) {
+    __m256i first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(target + index));
+    __m256i second = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + index));
+    __m256i value;
+    unsigned int generate;
+    unsigned int propagate;
+
+    if constexpr (Limbs::radix == 2) {
+      value = Subtract ? _mm256_sub_epi32(first, second) : _mm256_add_epi32(first, second);
+      __m256i bound = Subtract ? _mm256_max_epu32(first, second) : _mm256_min_epu32(value, first);
+      generate = ~_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(bound, first))) & full;
+      propagate = _mm256_movemask_ps(_mm256_castsi256_ps(
+              _mm256_cmpeq_epi32(value, _mm256_set1_epi32(Subtract ? 0 : -1))));
+    } else {
+      __m256i edge = _mm256_set1_epi64x(Subtract ? 0 : base - 1);
+      value = Subtract ? _mm256_sub_epi64(first, second) : _mm256_add_epi64(first, second);
+      generate = _mm256_movemask_pd(_mm256_castsi256_pd(
+              Subtract ? _mm256_cmpgt_epi64(edge, value) : _mm256_cmpgt_epi64(value, edge)));
+      propagate = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(value, edge)));
+    }
+
+    unsigned int lookahead = (generate << 1) + propagate + static_cast<unsigned int>(carry);
+    unsigned int carried = (lookahead ^ propagate) & full;
+    carry = lookahead >> lanes;
+
+    if constexpr (Limbs::radix == 2) {
+      __m256i bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+      __m256i mask = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(carried), bits), bits);
+      value = Subtract ? _mm256_add_epi32(value, mask) : _mm256_sub_epi32(value, mask);
+    } else {
+      __m256i bits = _mm256_setr_epi64x(1, 2, 4, 8);
+      __m256i mask = _mm256_cmpeq_epi64(_mm256_and_si256(_mm256_set1_epi64x(carried), bits), bits);
+      __m256i radix = _mm256_set1_epi64x(base);
+
+      if constexpr (Subtract) {
+        value = _mm256_add_epi64(value, mask);
+        value = _mm256_add_epi64(value, _mm256_and_si256(_mm256_cmpgt_epi64(_mm256_setzero_si256(), value), radix));
+      } else {
+        value = _mm256_sub_epi64(value, mask);
+        value = _mm256_sub_epi64(value, _mm256_and_si256(_mm256_cmpgt_epi64(value, _mm256_set1_epi64x(base - 1)),
+                                                         radix));
+      }
+    }
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(target + index), value);
+  }
+
+  return combineScalar<Subtract>(target + index, source + index, count - index, carry);
+}
+
+template <typename Limbs>
+template <bool Subtract>
+__attribute__((target("avx512f")))
+typename LimbKernels<Limbs>::wide_type LimbKernels<Limbs>::combineAvx512(limb_type* target, const limb_type* source,
+                                                                         size_t count, wide_type carry) {
+  const size_t lanes = 64 / sizeof(limb_type);
+  const unsigned int full = (1u << lanes) - 1;
+  size_t index = 0;
+
+  for (; index + lanes <= count; index += lanes) {
+    __m512i first = _mm512_loadu_si512(target + index);
+    __m512i second = _mm512_loadu_si512(source + index);
+    __m512i value;
+    unsigned int generate;
+    unsigned int propagate;
+
+    if constexpr (Limbs::radix == 2) {
+      value = Subtract ? _mm512_sub_epi32(first, second) : _mm512_add_epi32(first, second);
+      generate = Subtract ? _mm512_cmplt_epu32_mask(first, second) : _mm512_cmplt_epu32_mask(value, first);
+      propagate = _mm512_cmpeq_epi32_mask(value, _mm512_set1_epi32(Subtract ? 0 : -1));
+    } else {
+      __m512i edge = _mm512_set1_epi64(Subtract ? 0 : base - 1);
+      value = Subtract ? _mm512_sub_epi64(first, second) : _mm512_add_epi64(first, second);
+      generate = Subtract ? _mm512_cmplt_epi64_mask(value, edge) : _mm512_cmpgt_epi64_mask(value, edge);
+      propagate = _mm512_cmpeq_epi64_mask(value, edge);
+    }
+
+    unsigned int lookahead = (generate << 1) + propagate + static_cast<unsigned int>(carry);
+    unsigned int carried = (lookahead ^ propagate) & full;
+    carry = lookahead >> lanes;
+
+    if constexpr (Limbs::radix == 2) {
+      __m512i one = _mm512_set1_epi32(1);
+      value = Subtract ? _mm512_mask_sub_epi32(value, carried, value, one)
+                       : _mm512_mask_add_epi32(value, carried, value, one);
+    } else {
+      __m512i one = _mm512_set1_epi64(1);
+      __m512i radix = _mm512_set1_epi64(base);
+
+      if constexpr (Subtract) {
+        value = _mm512_mask_sub_epi64(value, carried, value, one);
+        value = _mm512_mask_add_epi64(value, _mm512_cmplt_epi64_mask(value, _mm512_setzero_si512()), value, radix);
+      } else {
+        value = _mm512_mask_add_epi64(value, carried, value, one);
+        value = _mm512_mask_sub_epi64(value, _mm512_cmpgt_epi64_mask(value, _mm512_set1_epi64(base - 1)),
+                                      value, radix);
+      }
+    }
+
+    _mm512_storeu_si512(target + index, value);
+  }
+
+  return combineScalar<Subtract>(target + index, source + index, count - index, carry);
+}
+
+template <typename Limbs>
+__attribute__((target("avx2")))
+size_t LimbKernels<Limbs>::mismatchAvx2(const limb_type* first, const limb_type* second, size_t count) {
+  const size_t lanes = 32 / sizeof(limb_type);
+  const unsigned int full = (1u << lanes) - 1;
+
+  for (; count >= lanes; count -= lanes) {
+    __m256i left = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + count - lanes));
+    __m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(second + count - lanes));
+    unsigned int equal;
+
+    if constexpr (Limbs::radix == 2) {
+      equal = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(left, right)));
+    } else {
+      equal = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(left, right)));
+    }
+
+    if (equal != full) {
+      return count - lanes + std::bit_width(~equal & full);
+    }
+  }
+
+  return mismatchScalar(first, second, count);
+}
+
+template <typename Limbs>
+__attribute__((target("avx512f")))
+size_t LimbKernels<Limbs>::mismatchAvx512(const limb_type* first, const limb_type* second, size_t count) {
+  const size_t lanes = 64 / sizeof(limb_type);
+  const unsigned int full = (1u << lanes) - 1;
+
+  for (; count >= lanes; count -= lanes) {
+    __m512i left = _mm512_loadu_si512(first + count - lanes);
+    __m512i right = _mm512_loadu_si512(second + count - lanes);
+    unsigned int equal;
+
+    if constexpr (Limbs::radix == 2) {
+      equal = _mm512_cmpeq_epi32_mask(left, right);
+    } else {
+      equal = _mm512_cmpeq_epi64_mask(left, right);
+    }
+
+    if (equal != full) {
+      return count - lanes + std::bit_width(~equal & full);
+    }
+  }
+
+  return mismatchScalar(first, second, count);
+}
+
+template <typename Limbs>
+__attribute__((target("avx2")))
+size_t LimbKernels<Limbs>::splitProductAvx2(const limb_type* source, size_t count, wide_type factor,
+                                            limb_type* low, limb_type* high) {
+  __m256i multiplier = _mm256_set1_epi64x(static_cast<long long>(factor));
+  size_t index = 0;
+
+  if constexpr (Limbs::radix == 2) {
+    __m256i order = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+
+    for (; index + 4 <= count; index += 4) {
+      __m256i limbs = _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index)));
+      __m256i halves = _mm256_permutevar8x32_epi32(_mm256_mul_epu32(limbs, multiplier), order);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(low + index), _mm256_castsi256_si128(halves));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(high + index), _mm256_extracti128_si256(halves, 1));
+    }
+  } else {
+    __m256d magic = _mm256_set1_pd(4503599627370496.0);
+    __m256i magic_bits = _mm256_castpd_si256(magic);
+    __m256i low_mask = _mm256_set1_epi64x(0xFFFFFFFFll);
+    __m256i radix = _mm256_set1_epi64x(base);
+    __m256i edge = _mm256_set1_epi64x(base - 1);
+
+    for (; index + 4 <= count; index += 4) {
+      __m256i product = _mm256_mul_epu32(
+              _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + index)), multiplier);
+      __m256d upper = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(_mm256_srli_epi64(product, 32), magic_bits)),
+                                    magic);
+      __m256d lower = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(product, low_mask),
+                                                                        magic_bits)), magic);
+      __m256d estimate = _mm256_floor_pd(_mm256_mul_pd(
+              _mm256_add_pd(_mm256_mul_pd(upper, _mm256_set1_pd(4294967296.0)), lower),
+              _mm256_set1_pd(1.0 / base)));
+
+      __m256i quotient = _mm256_sub_epi64(_mm256_castpd_si256(_mm256_add_pd(estimate, magic)), magic_bits);
+      __m256i remainder = _mm256_sub_epi64(product, _mm256_mul_epu32(quotient, radix));
+      __m256i under = _mm256_cmpgt_epi64(_mm256_setzero_si256(), remainder);
+      quotient = _mm256_add_epi64(quotient, under);
+      remainder = _mm256_add_epi64(remainder, _mm256_and_si256(under, radix));
+      __m256i over = _mm256_cmpgt_epi64(remainder, edge);
+      quotient = _mm256_sub_epi64(quotient, over);
+      remainder = _mm256_sub_epi64(remainder, _mm256_and_si256(over, radix));
+
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(low + index), remainder);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(high + index), quotient);
+    }
+  }
+
+  return index;
+}
+
+template <typename Limbs>
+__attribute__((target("avx512f")))
+size_t LimbKernels<Limbs>::splitProductAvx512(const limb_type* source, size_t count, wide_type factor,
+                                              limb_type* low, limb_type* high) {
+  __m512i multiplier = _mm512_set1_epi64(static_cast<long long>(factor));
+  size_t index = 0;
+
+  if constexpr (Limbs::radix == 2) {
+    for (; index + 8 <= count; index += 8) {
+      __m512i limbs = _mm512_cvtepu32_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + index)));
+      __m512i product = _mm512_mul_epu32(limbs, multiplier);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(low + index), _mm512_cvtepi64_epi32(product));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(high + index),
+                          _mm512_cvtepi64_epi32(_mm512_srli_epi64(product, 32)));
+    }
+  } else {
+    __m512d magic = _mm512_set1_pd(4503599627370496.0);
+    __m512i magic_bits = _mm512_castpd_si512(magic);
+    __m512i low_mask = _mm512_set1_epi64(0xFFFFFFFFll);
+    __m512i radix = _mm512_set1_epi64(base);
+    __m512i edge = _mm512_set1_epi64(base - 1);
+    __m512i one = _mm512_set1_epi64(1);
+
+    for (; index + 8 <= count; index += 8) {
+      __m512i product = _mm512_mul_epu32(_mm512_loadu_si512(source + index), multiplier);
+      __m512d upper = _mm512_sub_pd(_mm512_castsi512_pd(_mm512_or_si512(_mm512_srli_epi64(product, 32), magic_bits)),
+                                    magic);
+      __m512d lower = _mm512_sub_pd(_mm512_castsi512_pd(_mm512_or_si512(_mm512_and_si512(product, low_mask),
+                                                                        magic_bits)), magic);
+      __m512d estimate = _mm512_roundscale_pd(
+              _mm512_mul_pd(_mm512_fmadd_pd(upper, _mm512_set1_pd(4294967296.0), lower), _mm512_set1_pd(1.0 / base)),
+              _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+
+      __m512i quotient = _mm512_sub_epi64(_mm512_castpd_si512(_mm512_add_pd(estimate, magic)), magic_bits);
+      __m512i remainder = _mm512_sub_epi64(product, _mm512_mul_epu32(quotient, radix));
+      __mmask8 under = _mm512_cmplt_epi64_mask(remainder, _mm512_setzero_si512());
+      quotient = _mm512_mask_sub_epi64(quotient, under, quotient, one);
+      remainder = _mm512_mask_add_epi64(remainder, under, remainder, radix);
+      __mmask8 over = _mm512_cmpgt_epi64_mask(remainder, edge);
+      quotient = _mm512_mask_add_epi64(quotient, over, quotient, one);
+      remainder = _mm512_mask_sub_epi64(remainder, over, remainder, radix);
+
+      _mm512_storeu_si512(low + index, remainder);
+      _mm512_storeu_si512(high + index, quotient);
+    }
+  }
+
+  return index;
+}
+
+#pragma GCC diagnostic pop
+#endif
+
+template <typename Limbs>
+typename LimbKernels<Limbs>::wide_type LimbKernels<Limbs>::add(limb_type* target, const limb_type* source,
+                                                               size_t count) {
+#ifdef BIGINT_X86_SIMD
+  if (level == Level::Avx512) {
+    return combineAvx512<false>(target, source, count, 0);
+  }
+
+  if (level == Level::Avx2) {
+    return combineAvx2<false>(target, source, count, 0);
+  }
+#endif
+
+  return combineScalar<false>(target, source, count, 0);
+}
+
+template <typename Limbs>
+typename LimbKernels<Limbs>::wide_type LimbKernels<Limbs>::subtract(limb_type* target, const limb_type* source,
+                                                                    size_t count) {
+#ifdef BIGINT_X86_SIMD
+  if (level == Level::Avx512) {
+    return combineAvx512<true>(target, source, count, 0);
+  }
+
+  if (level == Level::Avx2) {
+    return combineAvx2<true>(target, source, count, 0);
+  }
+#endif
+
+  return combineScalar<true>(target, source, count, 0);
+}
+
+template <typename Limbs>
+int LimbKernels<Limbs>::compare(const limb_type* first, const limb_type* second, size_t count) {
+#ifdef BIGINT_X86_SIMD
+  if (level == Level::Avx512) {
+
+    count = mismatchAvx512(first, second, count);
+
+  } else if (level == Level::Avx2) {
+
+    count = mismatchAvx2(first, second, count);
+
+  } else {
+
+    count = mismatchScalar(first, second, count);
+  }
+#else
+  count = mismatchScalar(first, second, count);
+#endif
+
+  if (count == 0) {
+    return 0;
+  }
+
+  return first[count - 1] < second[count - 1] ? -1 : 1;
+}
+
+template <typename Limbs>
+void LimbKernels<Limbs>::splitProduct(const limb_type* source, size_t count, wide_type factor,
+                                      limb_type* low, limb_type* high) {
+  size_t index = 0;
+
+#ifdef BIGINT_X86_SIMD
+  if (level == Level::Avx512) {
+
+    index = splitProductAvx512(source, count, factor, low, high);
+
+  } else if (level == Level::Avx2) {
+
+    index = splitProductAvx2(source, count, factor, low, high);
+  }
+#endif
+
+  splitProductScalar(source + index, count - index, factor, low + index, high + index);
+}
+
+}
+
+namespace bigint::serial {
+
+const size_t header_size = 8;
+const size_t limb_size = 4;
+const uint64_t negative_flag = 1;
+const uint64_t binary_flag = 2;
+const size_t count_shift = 2;
+
+void store(std::byte* out, uint64_t value, size_t width) {
+  if constexpr (std::endian::native == std::endian::little) {
+    std::memcpy(out, &value, width);
+  } else {
+    for (size_t index = 0; index < width; ++index) {
+      out[index] = static_cast<std::byte>(value >> (8 * index));
+    }
+  }
+}
+
+uint64_t load(const std::byte* in, size_t width) {
+  uint64_t value = 0;
+
+  if constexpr (std::endian::native == std::endian::little) {
+    std::memcpy(&value, in, width);
+  } else {
+    for (size_t index = 0; index < width; ++index) {
+      value |= static_cast<uint64_t>(in[index]) << (8 * index);
+    }
+  }
+
+  return value;
+}
+
+}
+
+namespace bigint::hashing {
+
+const uint64_t secret[4] = {0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull,
+                            0x589965cc75374cc3ull};
+
+uint64_t mix(uint64_t first, uint64_t second) {
+  unsigned __int128 product = static_cast<unsigned __int128>(first) * second;
+  return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+}
+
+uint64_t pack(uint64_t low, uint64_t high) {
+  return low | (high << 32);
+}
+
+}
+
+class Rational;
+
+namespace bigint::expr {
+
+template <typename Derived>
+class Expression;
+
+template <typename Limbs>
+class Accumulator;
+
+}
+
+template <typename Limbs>
+class BasicModulus;
+
+template <size_t Bits>
+class FixedBigInteger;
+
+template <typename Limbs>
+class BasicBigIntegerView;
+
+template <typename Limbs>
+class BasicBigInteger {
+private:
+  using limb_type = typename Limbs::limb_type;
+  using wide_type = unsigned long long;
+  using allocator_type =
+          typename std::allocator_traits<typename Limbs::allocator_type>::template rebind_alloc<limb_type>;
+  using buffer_type = LimbBuffer<limb_type, Limbs::inline_capacity, allocator_type>;
+
+  Sign sign_ = Sign::Zero;
+  size_t digit_cnt_ = 0;
+  buffer_type digits_;
+
+  void swap(BasicBigInteger& other);
+
+  void removeLeadingZeros();
+
+  void removeLowLimbs(size_t count);
+
+  void assignMagnitude(wide_type magnitude);
+
+  limb_type getHighDigit() const;
+
+  limb_type getLimb(size_t index) const;
+
+  static int compareLimbs(const limb_type* first, size_t first_cnt,
+                          const limb_type* second, size_t second_cnt);
+
+  static void addLimbs(limb_type* target, size_t target_cnt, const limb_type* source, size_t source_cnt);
+
+  static void subtractLimbs(limb_type* target, size_t target_cnt, const limb_type* source, size_t source_cnt);
+
+  static void multiplySchoolbook(const limb_type* first, size_t first_cnt,
+                                 const limb_type* second, size_t second_cnt, limb_type* result);
+
+  static void squareSchoolbook(const limb_type* limbs, size_t count, limb_type* result);
+
+  static size_t karatsubaBufferSize(size_t count);
+
+  static void multiplyKaratsuba(const limb_type* first, const limb_type* second, size_t count,
+                                limb_type* result, limb_type* buffer);
+
+  static unsigned long long powerModulo(unsigned long long value, unsigned long long power,
+                                        unsigned long long modulus);
+
+  static size_t parallelWorkers(size_t limb_cnt);
+
+  template <typename Function>
+  static void runParallel(size_t workers, Function function);
+
+  template <unsigned int Modulus, unsigned int Root>
+  static void transformStages(unsigned int* values, size_t size, size_t min_length, size_t max_length,
+                              bool invert, size_t part, size_t parts);
+
+  template <unsigned int Modulus, unsigned int Root>
+  static void transform(std::vector<unsigned int>& values, bool invert, size_t workers);
+
+  template <unsigned int Modulus, unsigned int Root>
+  static std::vector<unsigned int> convolutionModulo(const std::vector<unsigned int>& first,
+                                                     const std::vector<unsigned int>& second,
+                                                     bool square, size_t size, size_t workers);
+
+  static std::vector<unsigned int> splitLimbs(const limb_type* limbs, size_t limb_cnt, size_t workers);
+
+  static void multiplyTransform(const limb_type* first, size_t first_cnt,
+                                const limb_type* second, size_t second_cnt, limb_type* result);
+
+  static void squareKaratsuba(const limb_type* limbs, size_t count, limb_type* result, limb_type* buffer);
+
+  static void multiplyLimbs(const limb_type* first, size_t first_cnt,
+                            const limb_type* second, size_t second_cnt, limb_type* result);
+
+  static void squareLimbs(const limb_type* limbs, size_t count, limb_type* result);
+
+  static void addMultipliedLimbs(limb_type* target, size_t target_cnt,
+                                 const limb_type* first, size_t first_cnt,
+                                 const limb_type* second, size_t second_cnt);
+
+  static wide_type divideLimbsWord(const limb_type* dividend, size_t dividend_cnt,
+                                   wide_type divisor, limb_type* quotient);
+
+  static limb_type divideLimbsShort(const limb_type* dividend, size_t dividend_cnt,
+                                    wide_type divisor, limb_type* quotient);
+
+  static void divideLimbs(const limb_type* dividend, size_t dividend_cnt,
+                          const limb_type* divisor, size_t divisor_cnt,
+                          limb_type* quotient, limb_type* remainder);
+
+  static void divideLimbsKnuth(const limb_type* dividend, size_t dividend_cnt,
+                               const limb_type* divisor, size_t divisor_cnt,
+                               limb_type* quotient, limb_type* remainder);
+
+  static BasicBigInteger reciprocalNewton(const BasicBigInteger& divisor);
+
+  static BasicBigInteger divisionByReciprocal(BasicBigInteger& dividend, const BasicBigInteger& divisor,
+                                              const BasicBigInteger& reciprocal);
+
+  static void divideLimbsNewton(const limb_type* dividend, size_t dividend_cnt,
+                                const limb_type* divisor, size_t divisor_cnt,
+                                limb_type* quotient, limb_type* remainder);
+
+  void fromLimbs(const limb_type* limbs, size_t limb_cnt);
+
+  static void writeChunk(char* out, wide_type value, size_t width);
+
+  static void writeDecimalLeaf(const BasicBigInteger& value, char* out, size_t width);
+
+  static void writeDecimalRecursive(const BasicBigInteger& value, const std::vector<BasicBigInteger>& powers,
+                                    const std::vector<BasicBigInteger>& reciprocals,
+                                    const std::vector<long long>& factors, size_t level, char* out);
+
+  void writeDecimal(std::string& result) const;
+
+  static wide_type parseEightDigits(const char* source);
+
+  static wide_type parseDigits(const char* source, size_t size);
+
+  void multiplyAddLimb(wide_type factor, wide_type addend);
+
+  static BasicBigInteger readDecimalRecursive(const wide_type* chunks, size_t chunk_cnt,
+                                              const std::vector<BasicBigInteger>& powers, size_t level);
+
+  void readDecimal(const wide_type* chunks, size_t chunk_cnt);
+
+  static BasicBigInteger divisionPositive(BasicBigInteger& dividend, const BasicBigInteger& divisor);
+
+  static Sign signProduct(const BasicBigInteger& first, const BasicBigInteger& second);
+
+  static void combineLimbs(const BasicBigInteger& first, long long first_factor,
+                           const BasicBigInteger& second, long long second_factor,
+                           std::vector<limb_type>& result);
+
+  static BasicBigInteger gcd(const BasicBigInteger& first, const BasicBigInteger& second);
+
+  static int signum(Sign sign);
+
+  size_t makeGreaterThan(const BasicBigInteger& other);
+
+  std::string toFullString() const;
+
+  void inverse();
+
+  bool isZero() const;
+
+  bool isPositive() const;
+
+  bool isNegative() const;
+
+  static BasicBigInteger powerOfTwo(size_t exponent);
+
+  static void negateLimbs(limb_type* limbs, size_t count);
+
+  template <typename Operation>
+  void applyBitwise(const BasicBigInteger& other, Operation operation);
+
+  long double logTwo() const;
+
+  static BasicBigInteger power(const BasicBigInteger& value, size_t exponent);
+
+  static BasicBigInteger rootEstimate(const BasicBigInteger& value, size_t degree);
+
+  static BasicBigInteger rootStep(const BasicBigInteger& value, const BasicBigInteger& root,
+                                  const BasicBigInteger& partial, size_t degree);
+
+  static BasicBigInteger rootNewton(const BasicBigInteger& value, size_t degree);
+
+  static bool isPrimeWord(wide_type value);
+
+  static bool isPowerResidue(const BasicBigInteger& value, size_t degree);
+
+  static std::vector<size_t> primesUpTo(size_t limit);
+
+  static void appendFactor(std::vector<long long>& factors, wide_type factor, size_t exponent);
+
+  static BasicBigInteger oddSwing(size_t value, const std::vector<size_t>& primes);
+
+  static BasicBigInteger oddFactorial(size_t value, const std::vector<size_t>& primes);
+
+  template <typename Derived>
+  void accumulateExpression(const Derived& expression, bool negate);
+
+  template <typename OtherLimbs>
+  friend class BasicBigInteger;
+
+  friend class bigint::expr::Accumulator<Limbs>;
+
+  friend class BasicModulus<Limbs>;
+
+  template <size_t Bits>
+  friend class FixedBigInteger;
+
+  template <typename OtherLimbs>
+  friend class BasicBigIntegerView;
+
+  friend class Rational;
+
+public:
+  static const long long base = Limbs::base;
+  static const size_t base_power = Limbs::base_power;
+  inline static size_t karatsuba_threshold = 24;
+  inline static size_t karatsuba_square_threshold = 48;
+  inline static size_t transform_threshold = Limbs::transform_threshold;
+  inline static size_t newton_threshold = 1200;
+  inline static size_t conversion_threshold = 32;
+  inline static size_t thread_count = 1;
+  inline static size_t parallel_threshold = 50000;
+  static const size_t transform_max_size = static_cast<size_t>(1) << 23;
+
+  ~BasicBigInteger() = default;
+
+  BasicBigInteger() = default;
+
+  BasicBigInteger& operator=(const BasicBigInteger& source) = default;
+
+  BasicBigInteger(const BasicBigInteger& source) = default;
+
+  BasicBigInteger& operator=(BasicBigInteger&& source) noexcept(std::is_nothrow_move_assignable_v<buffer_type>);
+
+  BasicBigInteger(BasicBigInteger&& source) noexcept;
+
+  BasicBigInteger(int source);
+
+  size_t getDigitCount() const;
+
+  std::span<const limb_type> getDigits() const;
+
+  explicit BasicBigInteger(long long source);
+
+  explicit BasicBigInteger(std::string_view source);
+
+  BasicBigInteger(const char* source, size_t size);
+
+  template <typename OtherLimbs>
+  explicit BasicBigInteger(const BasicBigInteger<OtherLimbs>& source);
+
+  template <typename Derived>
+  explicit BasicBigInteger(const bigint::expr::Expression<Derived>& source);
+
+  template <typename Derived>
+  BasicBigInteger& operator=(const bigint::expr::Expression<Derived>& source);
+
+  template <typename Derived>
+  BasicBigInteger& operator+=(const bigint::expr::Expression<Derived>& source);
+
+  template <typename Derived>
+  BasicBigInteger& operator-=(const bigint::expr::Expression<Derived>& source);
+
+  explicit operator bool() const;
+
+  std::string toString() const;
+
+  size_t serializedSize() const;
+
+  size_t serialize(std::span<std::byte> out) const;
+
+  std::vector<std::byte> serialize() const;
+
+  static BasicBigInteger deserialize(std::span<const std::byte> source);
+
+  size_t hash() const;
+
+  BasicBigInteger operator-() const&;
+
+  BasicBigInteger operator-() &&;
+
+  BasicBigInteger& operator+=(const BasicBigInteger& other);
+
+  BasicBigInteger& operator+=(long long other);
+
+  BasicBigInteger operator++(int);
+
+  BasicBigInteger& operator++();
+
+  BasicBigInteger operator--(int);
+
+  BasicBigInteger& operator--();
+
+  BasicBigInteger& operator-=(const BasicBigInteger& other);
+
+  BasicBigInteger& operator*=(const BasicBigInteger& other);
+
+  BasicBigInteger& operator*=(long long other);
+
+  BasicBigInteger& square();
+
+  BasicBigInteger& shiftLimbs(size_t count);
+
+  BasicBigInteger& operator<<=(size_t shift);
+
+  BasicBigInteger& operator>>=(size_t shift);
+
+  BasicBigInteger& operator&=(const BasicBigInteger& other);
+
+  BasicBigInteger& operator|=(const BasicBigInteger& other);
+
+  BasicBigInteger& operator^=(const BasicBigInteger& other);
+
+  [[nodiscard]] BasicBigInteger operator~() const;
+
+  size_t bitLength() const;
+
+  size_t popcount() const;
+
+  bool testBit(size_t index) const;
+
+  BasicBigInteger& operator/=(const BasicBigInteger& other);
+
+  BasicBigInteger& operator%=(const BasicBigInteger& other);
+
+  BasicBigInteger& operator/=(long long other);
+
+  BasicBigInteger& operator%=(long long other);
+
+  uint64_t divmod(uint64_t divisor);
+
+  std::vector<uint64_t> residues(std::span<const uint64_t> moduli) const;
+
+  BasicBigInteger isqrt() const;
+
+  BasicBigInteger iroot(size_t degree) const;
+
+  bool isPerfectPower() const;
+
+  template <typename Iterator>
+  static BasicBigInteger product(Iterator first, Iterator last);
+
+  static BasicBigInteger factorial(size_t value);
+
+  static BasicBigInteger binomial(size_t total, size_t chosen);
+
+  static int compare(const BasicBigInteger& that, const BasicBigInteger& other);
+
+  static int compare(const BasicBigInteger& that, long long other);
+
+  friend std::strong_ordering operator<=>(const BasicBigInteger& that, const BasicBigInteger& other) {
+    return compare(that, other) <=> 0;
+  }
+
+  friend std::strong_ordering operator<=>(const BasicBigInteger& that, long long other) {
+    return compare(that, other) <=> 0;
+  }
+
+  friend bool operator==(const BasicBigInteger& that, const BasicBigInteger& other) {
+    return compare(that, other) == 0;
+  }
+
+  friend bool operator==(const BasicBigInteger& that, long long other) {
+    return compare(that, other) == 0;
+  }
+
+  friend BasicBigInteger operator+(const BasicBigInteger& bi_first, const BasicBigInteger& bi_second) {
+    BasicBigInteger result(bi_first);
+    result += bi_second;
+    return result;
+  }
+
+  friend BasicBigInteger operator+(BasicBigInteger&& bi_first, const BasicBigInteger& bi_second) {
+    bi_first += bi_second;
+    return std::move(bi_first);
+  }
+
+  friend BasicBigInteger operator+(const BasicBigInteger& bi_first, BasicBigInteger&& bi_second) {
+    bi_second += bi_first;
+    return std::move(bi_second);
+  }
+
+  friend BasicBigInteger operator+(BasicBigInteger&& bi_first, BasicBigInteger&& bi_second) {
+    bi_first += bi_second;
+    return std::move(bi_first);
+  }
+
+  friend BasicBigInteger operator+(int int_first, const BasicBigInteger& bi_second) {
+    BasicBigInteger result(bi_second);
+    result += static_cast<long long>(int_first);
+    return result;
+  }
+
+  friend BasicBigInteger operator+(int int_first, BasicBigInteger&& bi_second) {
+    bi_second += static_cast<long long>(int_first);
+    return std::move(bi_second);
+  }
+
+  friend BasicBigInteger operator+(const BasicBigInteger& bi_first, int int_second) {
+    BasicBigInteger result(bi_first);
+    result += static_cast<long long>(int_second);
+    return result;
+  }
+
+  friend BasicBigInteger operator+(BasicBigInteger&& bi_first, int int_second) {
+    bi_first += static_cast<long long>(int_second);
+    return std::move(bi_first);
+  }
+
+  friend BasicBigInteger operator-(const BasicBigInteger& bi_first, const BasicBigInteger& bi_second) {
+    BasicBigInteger result(bi_first);
+    result -= bi_second;
+    return result;
+  }
+
+  friend BasicBigInteger operator-(BasicBigInteger&& bi_first, const BasicBigInteger& bi_second) {
+    bi_first -= bi_second;
+    return std::move(bi_first);
+  }
+
+  friend BasicBigInteger operator-(const BasicBigInteger& bi_first, BasicBigInteger&& bi_second) {
+    bi_second -= bi_first;
+    bi_second.inverse();
+    return std::move(bi_second);
+  }
+
+  friend BasicBigInteger operator-(BasicBigInteger&& bi_first, BasicBigInteger&& bi_second) {
+    bi_first -= bi_second;
+    return std::move(bi_first);
+  }
+
+  friend BasicBigInteger operator-(int int_first, const BasicBigInteger& bi_second) {
+    BasicBigInteger result(bi_second);
+    result += -static_cast<long long>(int_first);
+    result.inverse();
+    return result;
+  }
+
+  friend BasicBigInteger operator-(int int_first, BasicBigInteger&& bi_second) {
+    bi_second += -static_cast<long long>(int_first);
+    bi_second.inverse();
+    return std::move(bi_second);
+  }
+
+  friend BasicBigInteger operator-(const BasicBigInteger& bi_first, int int_second) {
+    BasicBigInteger result(bi_first);
+    result += -static_cast<long long>(int_second);
+    return result;
+  }
+
+  friend BasicBigInteger operator-(BasicBigInteger&& bi_first, int int_second) {
+    bi_first += -static_cast<long long>(int_second);
+    return std::move(bi_first);
+  }
+
+  friend BasicBigInteger operator*(const BasicBigInteger& bi_first, const BasicBigInteger& bi_second) {
+    BasicBigInteger result(bi_first);
+
+    if (&bi_first == &bi_second) {
+      result.square();
+    } else {
+      result *= bi_second;
+    }
+
+    return result;
+  }
+
+  friend BasicBigInteger operator*(BasicBigInteger&& bi_first, const BasicBigInteger& bi_second) {
+    bi_first *= bi_second;
+    return std::move(bi_first);
+  }
+
+  friend BasicBigInteger operator*(const BasicBigInteger& bi_first, BasicBigInteger&& bi_second) {
+    bi_second *= bi_first;
+    return std::move(bi_second);
+  }
+
+  friend BasicBigInteger operator*(BasicBigInteger&& bi_first, BasicBigInteger&& bi_second) {
+    bi_first *= bi_second;
+    return std::move(bi_first);
+  }
+
+  friend BasicBigInteger operator/(const BasicBigInteger& bi_first, const BasicBigInteger& bi_second) {
+    BasicBigInteger result(bi_first);
+    result /= bi_second;
+    return result;
+  }
+
+  friend BasicBigInteger operator/(BasicBigInteger&& bi_first, const BasicBigInteger& bi_second) {
+    bi_first /= bi_second;
+    return std::move(bi_first);
+  }
+
+  friend BasicBigInteger operator/(const BasicBigInteger& bi_first, long long ll_second) {
+    BasicBigInteger result(bi_first);
+    result /= ll_second;
+    return result;
+  }
+
+  friend BasicBigInteger operator/(BasicBigInteger&& bi_first, long long ll_second) {
+    bi_first /= ll_second;
+    return std::move(bi_first);
+  }
+
+  friend BasicBigInteger operator%(const BasicBigInteger& bi_first, const BasicBigInteger& bi_second) {
+    BasicBigInteger result(bi_first);
+    result %= bi_second;
+    return result;
+  }
+
+  friend BasicBigInteger operator%(BasicBigInteger&& bi_first, const BasicBigInteger& bi_second) {
+    bi_first %= bi_second;
+    return std::move(bi_first);
+  }
+
+  friend BasicBigInteger operator%(const BasicBigInteger& bi_first, long long ll_second) {
+    BasicBigInteger result(bi_first);
+    result %= ll_second;
+    return result;
+  }
+
+  friend BasicBigInteger operator%(BasicBigInteger&& bi_first, long long ll_second) {
+    bi_first %= ll_second;
+    return std::move(bi_first);
+  }
+
+  [[nodiscard]] friend BasicBigInteger operator<<(const BasicBigInteger& bi_first, size_t shift) {
+    BasicBigInteger result(bi_first);
+    result <<= shift;
+    return result;
+  }
+
+  [[nodiscard]] friend BasicBigInteger operator<<(BasicBigInteger&& bi_first, size_t shift) {
+    bi_first <<= shift;
+    return std::move(bi_first);
+  }
+
+  [[nodiscard]] friend BasicBigInteger operator>>(const BasicBigInteger& bi_first, size_t shift) {
+    BasicBigInteger result(bi_first);
+    result >>= shift;
+    return result;
+  }
+
+  [[nodiscard]] friend BasicBigInteger operator>>(BasicBigInteger&& bi_first, size_t shift) {
+    bi_first >>= shift;
+    return std::move(bi_first);
+  }
+
+  friend BasicBigInteger operator&(const BasicBigInteger& bi_first, const BasicBigInteger& bi_second) {
+    BasicBigInteger result(bi_first);
+    result &= bi_second;
+    return result;
+  }
+
+  friend BasicBigInteger operator&(BasicBigInteger&& bi_first, const BasicBigInteger& bi_second) {
+    bi_first &= bi_second;
+    return std::move(bi_first);
+  }
+
+  friend BasicBigInteger operator&(const BasicBigInteger& bi_first, BasicBigInteger&& bi_second) {
+    bi_second &= bi_first;
+    return std::move(bi_second);
+  }
+
+  friend BasicBigInteger operator&(BasicBigInteger&& bi_first, BasicBigInteger&& bi_second) {
+    bi_first &= bi_second;
+    return std::move(bi_first);
+  }
+
+  friend BasicBigInteger operator|(const BasicBigInteger& bi_first, const BasicBigInteger& bi_second) {
+    BasicBigInteger result(bi_first);
+    result |= bi_second;
+    return result;
+  }
+
+  friend BasicBigInteger operator|(BasicBigInteger&& bi_first, const BasicBigInteger& bi_second) {
+    bi_first |= bi_second;
+    return std::move(bi_first);
+  }
+
+  friend BasicBigInteger operator|(const BasicBigInteger& bi_first, BasicBigInteger&& bi_second) {
+    bi_second |= bi_first;
+    return std::move(bi_second);
+  }
+
+  friend BasicBigInteger operator|(BasicBigInteger&& bi_first, BasicBigInteger&& bi_second) {
+    bi_first |= bi_second;
+    return std::move(bi_first);
+  }
+
+  friend BasicBigInteger operator^(const BasicBigInteger& bi_first, const BasicBigInteger& bi_second) {
+    BasicBigInteger result(bi_first);
+    result ^= bi_second;
+    return result;
+  }
+
+  friend BasicBigInteger operator^(BasicBigInteger&& bi_first, const BasicBigInteger& bi_second) {
+    bi_first ^= bi_second;
+    return std::move(bi_first);
+  }
+
+  friend BasicBigInteger operator^(const BasicBigInteger& bi_first, BasicBigInteger&& bi_second) {
+    bi_second ^= bi_first;
+    return std::move(bi_second);
+  }
+
+  friend BasicBigInteger operator^(BasicBigInteger&& bi_first, BasicBigInteger&& bi_second) {
+    bi_first ^= bi_second;
+    return std::move(bi_first);
+  }
+};
+
+using BigInteger = BasicBigInteger<DecimalLimbs>;
+
+using BinaryBigInteger = BasicBigInteger<BinaryLimbs>;
+
+using ArenaBigInteger = BasicBigInteger<ArenaLimbs<DecimalLimbs>>;
+
+using ArenaBinaryBigInteger = BasicBigInteger<ArenaLimbs<BinaryLimbs>>;
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::swap(BasicBigInteger& other) {
+  std::swap(sign_, other.sign_);
+  std::swap(digit_cnt_, other.digit_cnt_);
+  digits_.swap(other.digits_);
+}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::removeLeadingZeros() {
+  while (digit_cnt_ > 0 && digits_[digit_cnt_ - 1] == 0) {
+    --digit_cnt_;
+  }
+
+  digits_.resize(digit_cnt_);
+
+  if (digit_cnt_ == 0) {
+    sign_ = Sign::Zero;
+  }
+}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::removeLowLimbs(size_t count) {
+  if (count >= digit_cnt_) {
+    *this = BasicBigInteger();
+    return;
+  }
+
+  digits_.erase(digits_.begin(), digits_.begin() + count);
+  digit_cnt_ -= count;
+}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::assignMagnitude(wide_type magnitude) {
+  digits_.clear();
+
+  while (magnitude > 0) {
+    digits_.push_back(static_cast<limb_type>(magnitude % base));
+    magnitude /= base;
+  }
+
+  digit_cnt_ = digits_.size();
+}
+
+template <typename Limbs>
+typename BasicBigInteger<Limbs>::limb_type BasicBigInteger<Limbs>::getHighDigit() const {
+  if (isZero()) {
+    return 0;
+  }
+
+  return digits_[digit_cnt_ - 1];
+}
+
+template <typename Limbs>
+int BasicBigInteger<Limbs>::compareLimbs(const limb_type* first, size_t first_cnt,
+                                         const limb_type* second, size_t second_cnt) {
+  if (first_cnt != second_cnt) {
+    return first_cnt < second_cnt ? -1 : 1;
+  }
+
+  return bigint::simd::LimbKernels<Limbs>::compare(first, second, first_cnt);
+}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::addLimbs(limb_type* target, size_t target_cnt,
+                                      const limb_type* source, size_t source_cnt) {
+  wide_type carry = bigint::simd::LimbKernels<Limbs>::add(target, source, source_cnt);
+  size_t index = source_cnt;
+
+  for (; carry != 0 && index < target_cnt; ++index) {
+    wide_type current = static_cast<wide_type>(target[index]) + 1;
+    carry = current == base ? 1 : 0;
+    target[index] = static_cast<limb_type>(current - carry * base);
+  }
+}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::subtractLimbs(limb_type* target, size_t target_cnt,
+                                           const limb_type* source, size_t source_cnt) {
+  wide_type borrow = bigint::simd::LimbKernels<Limbs>::subtract(target, source, source_cnt);
+  size_t index = source_cnt;
+
+  for (; borrow != 0 && index < target_cnt; ++index) {
+    borrow = target[index] == 0 ? 1 : 0;
+    target[index] = static_cast<limb_type>(static_cast<wide_type>(target[index]) + borrow * base - 1);
+  }
+}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::multiplySchoolbook(const limb_type* first, size_t first_cnt,
+                                                const limb_type* second, size_t second_cnt,
+                                                limb_type* result) {
+  std::fill(result, result + first_cnt + second_cnt, 0);
+
+  for (size_t index_sec = 0; index_sec < second_cnt; ++index_sec) {
+    if (second[index_sec] == 0) {
+      continue;
+    }
+
+    wide_type carry = 0;
+
+    for (size_t index = 0; index < first_cnt; ++index) {
+      wide_type current = static_cast<wide_type>(first[index]) * second[index_sec] +
+                          result[index + index_sec] + carry;
+      carry = current / base;
+      result[index + index_sec] = static_cast<limb_type>(current % base);
+    }
+
+    result[index_sec + first_cnt] = static_cast<limb_type>(carry);
+  }
+}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::squareSchoolbook(const limb_type* limbs, size_t count, limb_type* result) {
+  std::fill(result, result + 2 * count, 0);
+
+  for (size_t index_sec = 0; index_sec < count; ++index_sec) {
+    if (limbs[index_sec] == 0) {
+      continue;
+    }
+
+    wide_type carry = 0;
+
+    for (size_t index = index_sec + 1; index < count; ++index) {
+      wide_type current = static_cast<wide_type>(limbs[index]) * limbs[index_sec] +
+                          result[index + index_sec] + carry;
+      carry = current / base;
+      result[index + index_sec] = static_cast<limb_type>(current % base);
+    }
+
+    result[index_sec + count] = static_cast<limb_type>(carry);
+  }
+
+  wide_type carry = 0;
+
+  for (size_t index = 0; index < 2 * count; ++index) {
+    wide_type current = 2 * static_cast<wide_type>(result[index]) + carry;
+    carry = current / base;
+    result[index] = static_cast<limb_type>(current % base);
+  }
+
+  carry = 0;
+
+  for (size_t index = 0; index < count; ++index) {
+    wide_type square = static_cast<wide_type>(limbs[index]) * limbs[index];
+    wide_type current = square % base + result[2 * index] + carry;
+    result[2 * index] = static_cast<limb_type>(current % base);
+    current = current / base + square / base + result[2 * index + 1];
+    result[2 * index + 1] = static_cast<limb_type>(current % base);
+    carry = current / base;
+  }
+}
+
+template <typename Limbs>
+size_t BasicBigInteger<Limbs>::karatsubaBufferSize(size_t count) {
+  size_t result = 0;
+
+  while (count >= std::max(std::min(karatsuba_threshold, karatsuba_square_threshold), static_cast<size_t>(4))) {
+    count = count - count / 2 + 1;
+    result += 4 * count;
+  }
+
+  return result;
+}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::multiplyKaratsuba(const limb_type* first, const limb_type* second,
+                                               size_t count, limb_type* result, limb_type* buffer) {
+  if (count < std::max(karatsuba_threshold, static_cast<size_t>(4))) {
+    multiplySchoolbook(first, count, second, count, result);
+    return;
+  }
+
+  size_t low_cnt = count / 2;
+  size_t high_cnt = count - low_cnt;
+  size_t sum_cnt = high_cnt + 1;
+
+  limb_type* first_sum = buffer;
+  limb_type* second_sum = first_sum + sum_cnt;
+  limb_type* middle = second_sum + sum_cnt;
+
+  multiplyKaratsuba(first, second, low_cnt, result, buffer);
+  multiplyKaratsuba(first + low_cnt, second + low_cnt, high_cnt, result + 2 * low_cnt, buffer);
+
+  std::copy(first + low_cnt, first + count, first_sum);
+  std::copy(second + low_cnt, second + count, second_sum);
+  first_sum[high_cnt] = 0;
+  second_sum[high_cnt] = 0;
+  addLimbs(first_sum, sum_cnt, first, low_cnt);
+  addLimbs(second_sum, sum_cnt, second, low_cnt);
+
+  multiplyKaratsuba(first_sum, second_sum, sum_cnt, middle, middle + 2 * sum_cnt);
+  subtractLimbs(middle, 2 * sum_cnt, result, 2 * low_cnt);
+  subtractLimbs(middle, 2 * sum_cnt, result + 2 * low_cnt, 2 * high_cnt);
+
+  addLimbs(result + low_cnt, 2 * count - low_cnt, middle,
+           std::min(2 * sum_cnt, 2 * count - low_cnt));
+}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::squareKaratsuba(const limb_type* limbs, size_t count,
+                                             limb_type* result, limb_type* buffer) {
+  if (count < std::max(karatsuba_square_threshold, static_cast<size_t>(4))) {
+    squareSchoolbook(limbs, count, result);
+    return;
+  }
+
+  size_t low_cnt = count / 2;
+  size_t high_cnt = count - low_cnt;
+  size_t sum_cnt = high_cnt + 1;
+
+  limb_type* sum = buffer;
+  limb_type* middle = sum + sum_cnt;
+
+  squareKaratsuba(limbs, low_cnt, result, buffer);
+  squareKaratsuba(limbs + low_cnt, high_cnt, result + 2 * low_cnt, buffer);
+
+  std::copy(limbs + low_cnt, limbs + count, sum);
+  sum[high_cnt] = 0;
+  addLimbs(sum, sum_cnt, limbs, low_cnt);
+
+  squareKaratsuba(sum, sum_cnt, middle, middle + 2 * sum_cnt);
+  subtractLimbs(middle, 2 * sum_cnt, result, 2 * low_cnt);
+  subtractLimbs(middle, 2 * sum_cnt, result + 2 * low_cnt, 2 * high_cnt);
+
+  addLimbs(result + low_cnt, 2 * count - low_cnt, middle,
+           std::min(2 * sum_cnt, 2 * count - low_cnt));
+}
+
+template <typename Limbs>
+unsigned long long BasicBigInteger<Limbs>::powerModulo(unsigned long long value, unsigned long long power,
+                                                       unsigned long long modulus) {
+  unsigned long long result = 1;
+  value %= modulus;
+
+  while (power > 0) {
+    if (power & 1) {
+      result = result * value % modulus;
+    }
+
+    value = value * value % modulus;
+    power >>= 1;
+  }
+
+  return result;
+}
+
+template <typename Limbs>
+size_t BasicBigInteger<Limbs>::parallelWorkers(size_t limb_cnt) {
+  return limb_cnt >= parallel_threshold ? std::max(thread_count, static_cast<size_t>(1)) : 1;
+}
+
+template <typename Limbs>
+template <typename Function>
+void BasicBigInteger<Limbs>::runParallel(size_t workers, Function function) {
+  bigint::parallel::WorkerPool::instance().run(workers, workers - 1, function);
+}
+
+template <typename Limbs>
+template <unsigned int Modulus, unsigned int Root>
+void BasicBigInteger<Limbs>::transformStages(unsigned int* values, size_t size, size_t min_length,
+                                             size_t max_length, bool invert, size_t part, size_t parts) {
+  std::vector<unsigned int> roots;
+
+  for (size_t stage = min_length; stage <= max_length; stage <<= 1) {
+    size_t length = invert ? stage : max_length / (stage / min_length);
+    size_t half = length / 2;
+    size_t begin = half * part / parts;
+    size_t end = half * (part + 1) / parts;
+    unsigned long long step = powerModulo(Root, (Modulus - 1) / length, Modulus);
+
+    if (invert) {
+      step = powerModulo(step, Modulus - 2, Modulus);
+    }
+
+    if (begin == end) {
+      continue;
+    }
+
+    roots.resize(end - begin);
+    roots[0] = powerModulo(step, begin, Modulus);
+
+    for (size_t index = 1; index < roots.size(); ++index) {
+      roots[index] = static_cast<unsigned long long>(roots[index - 1]) * step % Modulus;
+    }
+
+    if (invert) {
+
+      for (size_t start = 0; start < size; start += length) {
+        unsigned int* low = values + start;
+        unsigned int* high = low + half;
+
+        for (size_t index = begin; index < end; ++index) {
+          unsigned int even = low[index];
+          unsigned int odd = static_cast<unsigned long long>(high[index]) * roots[index - begin] % Modulus;
+          low[index] = even + odd >= Modulus ? even + odd - Modulus : even + odd;
+          high[index] = even >= odd ? even - odd : even + Modulus - odd;
+        }
+      }
+
+    } else {
+
+      for (size_t start = 0; start < size; start += length) {
+        unsigned int* low = values + start;
+        unsigned int* high = low + half;
+
+        for (size_t index = begin; index < end; ++index) {
+          unsigned int even = low[index];
+          unsigned int odd = high[index];
+          low[index] = even + odd >= Modulus ? even + odd - Modulus : even + odd;
+          high[index] = static_cast<unsigned long long>(even + Modulus - odd) * roots[index - begin] % Modulus;
+        }
+      }
+    }
+  }
+}
+
+template <typename Limbs>
+template <unsigned int Modulus, unsigned int Root>
+void BasicBigInteger<Limbs>::transform(std::vector<unsigned int>& values, bool invert, size_t workers) {
+  size_t size = values.size();
+  workers = std::bit_floor(std::max(std::min(workers, size / 2), static_cast<size_t>(1)));
+  size_t block = size / workers;
+
+  auto block_stages = [&]() {
+    runParallel(workers, [&](size_t worker) {
+      transformStages<Modulus, Root>(values.data() + worker * block, block, 2, block, invert, 0, 1);
+    });
+  };
+
+  auto cross_stage = [&](size_t length) {
+    runParallel(workers, [&](size_t worker) {
+      transformStages<Modulus, Root>(values.data(), size, length, length, invert, worker, workers);
+    });
+  };
+
+  if (invert) {
+
+    block_stages();
+
+    for (size_t length = 2 * block; length <= size; length <<= 1) {
+      cross_stage(length);
+    }
+
+  } else {
+
+    for (size_t length = size; length > block; length >>= 1) {
+      cross_stage(length);
+    }
+
+    block_stages();
+  }
+}
+
+template <typename Limbs>
+template <unsigned int Modulus, unsigned int Root>
+std::vector<unsigned int> BasicBigInteger<Limbs>::convolutionModulo(const std::vector<unsigned int>& first,
+                                                                    const std::vector<unsigned int>& second,
+                                                                    bool square, size_t size, size_t workers) {
+  std::vector<unsigned int> first_values(size, 0);
+  std::vector<unsigned int> second_values(square ? 0 : size, 0);
+
+  runParallel(workers, [&](size_t worker) {
+    for (size_t index = first.size() * worker / workers; index < first.size() * (worker + 1) / workers; ++index) {
+      first_values[index] = first[index] % Modulus;
+    }
+
+    for (size_t index = second.size() * worker / workers; index < second.size() * (worker + 1) / workers; ++index) {
+      second_values[index] = second[index] % Modulus;
+    }
+  });
+
+  transform<Modulus, Root>(first_values, false, workers);
+
+  if (!square) {
+    transform<Modulus, Root>(second_values, false, workers);
+  }
+
+  unsigned long long size_inverse = powerModulo(size, Modulus - 2, Modulus);
+
+  runParallel(workers, [&](size_t worker) {
+    const std::vector<unsigned int>& factors = square ? first_values : second_values;
+
+    for (size_t index = size * worker / workers; index < size * (worker + 1) / workers; ++index) {
+      first_values[index] = static_cast<unsigned long long>(first_values[index]) * factors[index] % Modulus *
+                            size_inverse % Modulus;
+    }
+  });
+
+  transform<Modulus, Root>(first_values, true, workers);
+  return first_values;
+}
+
+template <typename Limbs>
+std::vector<unsigned int> BasicBigInteger<Limbs>::splitLimbs(const limb_type* limbs, size_t limb_cnt,
+                                                             size_t workers) {
+  std::vector<unsigned int> result(limb_cnt * Limbs::transform_split);
+
+  runParallel(workers, [&](size_t worker) {
+    for (size_t index = limb_cnt * worker / workers; index < limb_cnt * (worker + 1) / workers; ++index) {
+      wide_type limb = limbs[index];
+
+      for (size_t part = 0; part < Limbs::transform_split; ++part) {
+        result[index * Limbs::transform_split + part] =
+                static_cast<unsigned int>(limb % Limbs::transform_base);
+        limb /= Limbs::transform_base;
+      }
+    }
+  });
+
+  return result;
+}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::multiplyTransform(const limb_type* first, size_t first_cnt,
+                                               const limb_type* second, size_t second_cnt,
+                                               limb_type* result) {
+  const unsigned long long modulus_first = 998244353;
+  const unsigned long long modulus_second = 167772161;
+  const unsigned long long modulus_third = 469762049;
+
+  size_t limb_cnt = first_cnt + second_cnt;
+  size_t workers = parallelWorkers(limb_cnt);
+
+  bool square = first == second && first_cnt == second_cnt;
+  std::vector<unsigned int> first_parts(splitLimbs(first, first_cnt, workers));
+  std::vector<unsigned int> second_parts;
+
+  if (!square) {
+    second_parts = splitLimbs(second, second_cnt, workers);
+  }
+
+  size_t part_cnt = limb_cnt * Limbs::transform_split;
+  size_t size = 1;
+
+  while (size < part_cnt) {
+    size <<= 1;
+  }
+
+  std::vector<unsigned int> residues_first;
+  std::vector<unsigned int> residues_second;
+  std::vector<unsigned int> residues_third;
+
+  bigint::parallel::WorkerPool::instance().run(3, workers - 1, [&](size_t prime) {
+    if (prime == 0) {
+
+      residues_first = convolutionModulo<modulus_first, 3>(first_parts, second_parts, square, size, workers);
+
+    } else if (prime == 1) {
+
+      residues_second = convolutionModulo<modulus_second, 3>(first_parts, second_parts, square, size, workers);
+
+    } else {
+
+      residues_third = convolutionModulo<modulus_third, 3>(first_parts, second_parts, square, size, workers);
+    }
+  });
+
+  unsigned long long first_inverse = powerModulo(modulus_first, modulus_second - 2, modulus_second);
+  unsigned long long product_inverse = powerModulo(modulus_first * modulus_second % modulus_third,
+                                                   modulus_third - 2, modulus_third);
+  std::vector<unsigned __int128> carries(workers, 0);
+
+  runParallel(workers, [&](size_t worker) {
+    unsigned __int128 carry = 0;
+    wide_type part_scale = 1;
+    size_t begin = limb_cnt * worker / workers * Limbs::transform_split;
+    size_t end = limb_cnt * (worker + 1) / workers * Limbs::transform_split;
+
+    std::fill(result + begin / Limbs::transform_split, result + end / Limbs::transform_split, 0);
+
+    for (size_t index = begin; index < end; ++index) {
+      unsigned long long value_first = residues_first[index];
+      unsigned long long value_second = (residues_second[index] + modulus_second -
+                                         value_first % modulus_second) * first_inverse % modulus_second;
+      unsigned long long value_third = (residues_third[index] + modulus_third -
+                                        (value_first + modulus_first * value_second) % modulus_third) %
+                                       modulus_third * product_inverse % modulus_third;
+
+      carry += value_first + static_cast<unsigned __int128>(modulus_first) *
+                             (value_second + modulus_second * value_third);
+
+      size_t part = index % Limbs::transform_split;
+      part_scale = part == 0 ? 1 : part_scale * Limbs::transform_base;
+      result[index / Limbs::transform_split] +=
+              static_cast<limb_type>(static_cast<wide_type>(carry % Limbs::transform_base) * part_scale);
+      carry /= Limbs::transform_base;
+    }
+
+    carries[worker] = carry;
+  });
+
+  for (size_t worker = 0; worker + 1 < workers; ++worker) {
+    size_t offset = limb_cnt * (worker + 1) / workers;
+    limb_type carry_limbs[4];
+    size_t carry_cnt = 0;
+
+    for (unsigned __int128 carry = carries[worker]; carry > 0; carry /= base) {
+      carry_limbs[carry_cnt++] = static_cast<limb_type>(carry % base);
+    }
+
+    addLimbs(result + offset, limb_cnt - offset, carry_limbs, carry_cnt);
+  }
+}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::multiplyLimbs(const limb_type* first, size_t first_cnt,
+                                           const limb_type* second, size_t second_cnt,
+                                           limb_type* result) {
+  if (first == second && first_cnt == second_cnt) {
+    squareLimbs(first, first_cnt, result);
+    return;
+  }
+
+  if (first_cnt < second_cnt) {
+    std::swap(first, second);
+    std::swap(first_cnt, second_cnt);
+  }
+
+  if (second_cnt < std::max(karatsuba_threshold, static_cast<size_t>(4))) {
+    multiplySchoolbook(first, first_cnt, second, second_cnt, result);
+    return;
+  }
+
+  if (second_cnt >= transform_threshold &&
+      (first_cnt + second_cnt) * Limbs::transform_split <= transform_max_size) {
+    multiplyTransform(first, first_cnt, second, second_cnt, result);
+    return;
+  }
+
+  std::vector<limb_type> buffer(karatsubaBufferSize(second_cnt));
+
+  if (first_cnt == second_cnt) {
+    multiplyKaratsuba(first, second, second_cnt, result, buffer.data());
+    return;
+  }
+
+  std::vector<limb_type> chunk(2 * second_cnt);
+  std::fill(result, result + first_cnt + second_cnt, 0);
+
+  for (size_t offset = 0; offset < first_cnt; offset += second_cnt) {
+    size_t chunk_cnt = std::min(second_cnt, first_cnt - offset);
+
+    if (chunk_cnt == second_cnt) {
+      multiplyKaratsuba(first + offset, second, second_cnt, chunk.data(), buffer.data());
+    } else {
+      multiplyLimbs(first + offset, chunk_cnt, second, second_cnt, chunk.data());
+    }
+
+    addLimbs(result + offset, first_cnt + second_cnt - offset, chunk.data(), chunk_cnt + second_cnt);
+  }
+}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::squareLimbs(const limb_type* limbs, size_t count, limb_type* result) {
+  if (count < std::max(karatsuba_square_threshold, static_cast<size_t>(4))) {
+    squareSchoolbook(limbs, count, result);
+    return;
+  }
+
+  if (count >= transform_threshold && 2 * count * Limbs::transform_split <= transform_max_size) {
+    multiplyTransform(limbs, count, limbs, count, result);
+    return;
+  }
+
+  std::vector<limb_type> buffer(karatsubaBufferSize(count));
+  squareKaratsuba(limbs, count, result, buffer.data());
+}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::addMultipliedLimbs(limb_type* target, size_t target_cnt,
+                                                const limb_type* first, size_t first_cnt,
+                                                const limb_type* second, size_t second_cnt) {
+  if (std::min(first_cnt, second_cnt) >= karatsuba_threshold) {
+    std::vector<limb_type> product(first_cnt + second_cnt);
+    multiplyLimbs(first, first_cnt, second, second_cnt, product.data());
+    addLimbs(target, target_cnt, product.data(), product.size());
+    return;
+  }
+
+  for (size_t index_sec = 0; index_sec < second_cnt; ++index_sec) {
+    if (second[index_sec] == 0) {
+      continue;
+    }
+
+    wide_type carry = 0;
+    size_t index = index_sec;
+
+    for (size_t index_first = 0; index_first < first_cnt; ++index_first, ++index) {
+      wide_type current = static_cast<wide_type>(first[index_first]) * second[index_sec] +
+                          static_cast<wide_type>(target[index]) + carry;
+      carry = current / base;
+      target[index] = static_cast<limb_type>(current % base);
+    }
+
+    for (; carry != 0 && index < target_cnt; ++index) {
+      wide_type current = static_cast<wide_type>(target[index]) + carry;
+      carry = current / base;
+      target[index] = static_cast<limb_type>(current % base);
+    }
+  }
+}
+
+template <typename Limbs>
+typename BasicBigInteger<Limbs>::limb_type
+BasicBigInteger<Limbs>::divideLimbsShort(const limb_type* dividend, size_t dividend_cnt,
+                                         wide_type divisor, limb_type* quotient) {
+  return static_cast<limb_type>(divideLimbsWord(dividend, dividend_cnt, divisor, quotient));
+}
+
+template <typename Limbs>
+typename BasicBigInteger<Limbs>::wide_type
+BasicBigInteger<Limbs>::divideLimbsWord(const limb_type* dividend, size_t dividend_cnt,
+                                        wide_type divisor, limb_type* quotient) {
+  wide_type remainder = 0;
+
+  if (divisor > ~static_cast<wide_type>(0) / base) {
+
+    for (size_t index = dividend_cnt; index > 0; --index) {
+      unsigned __int128 current = static_cast<unsigned __int128>(remainder) * base + dividend[index - 1];
+      remainder = static_cast<wide_type>(current % divisor);
+
+      if (quotient != nullptr) {
+        quotient[index - 1] = static_cast<limb_type>(current / divisor);
+      }
+    }
+
+    return remainder;
+  }
+
+  wide_type reciprocal = ~static_cast<wide_type>(0) / divisor;
+
+  for (size_t index = dividend_cnt; index > 0; --index) {
+    wide_type current = remainder * base + dividend[index - 1];
+    wide_type digit = static_cast<wide_type>((static_cast<unsigned __int128>(current) * reciprocal) >> 64);
+    remainder = current - digit * divisor;
+
+    while (remainder >= divisor) {
+      remainder -= divisor;
+      ++digit;
+    }
+
+    if (quotient != nullptr) {
+      quotient[index - 1] = static_cast<limb_type>(digit);
+    }
+  }
+
+  return remainder;
+}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::divideLimbs(const limb_type* dividend, size_t dividend_cnt,
+                                         const limb_type* divisor, size_t divisor_cnt,
+                                         limb_type* quotient, limb_type* remainder) {
+  if (divisor_cnt >= newton_threshold && dividend_cnt - divisor_cnt >= newton_threshold / 2) {
+    divideLimbsNewton(dividend, dividend_cnt, divisor, divisor_cnt, quotient, remainder);
+    return;
+  }
+
+  divideLimbsKnuth(dividend, dividend_cnt, divisor, divisor_cnt, quotient, remainder);
+}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::divideLimbsKnuth(const limb_type* dividend, size_t dividend_cnt,
+                                              const limb_type* divisor, size_t divisor_cnt,
+                                              limb_type* quotient, limb_type* remainder) {
+  if (divisor_cnt == 1) {
+    remainder[0] = divideLimbsShort(dividend, dividend_cnt, divisor[0], quotient);
+    return;
+  }
+
+  wide_type factor = base / (static_cast<wide_type>(divisor[divisor_cnt - 1]) + 1);
+  std::vector<limb_type> dividend_norm(dividend_cnt + 1, 0);
+  std::vector<limb_type> divisor_norm(divisor_cnt, 0);
+  wide_type carry = 0;
+
+  for (size_t index = 0; index < dividend_cnt; ++index) {
+    wide_type current = dividend[index] * factor + carry;
+    carry = current / base;
+    dividend_norm[index] = static_cast<limb_type>(current % base);
+  }
+
+  dividend_norm[dividend_cnt] = static_cast<limb_type>(carry);
+  carry = 0;
+
+  for (size_t index = 0; index < divisor_cnt; ++index) {
+    wide_type current = divisor[index] * factor + carry;
+    carry = current / base;
+    divisor_norm[index] = static_cast<limb_type>(current % base);
+  }
+
+  wide_type divisor_high = divisor_norm[divisor_cnt - 1];
+  wide_type divisor_next = divisor_norm[divisor_cnt - 2];
+
+  for (size_t shift = dividend_cnt - divisor_cnt + 1; shift > 0; --shift) {
+    limb_type* window = dividend_norm.data() + shift - 1;
+    wide_type numerator = static_cast<wide_type>(window[divisor_cnt]) * base + window[divisor_cnt - 1];
+    wide_type ratio = numerator / divisor_high;
+    wide_type rest = numerator % divisor_high;
+
+    while (ratio >= static_cast<wide_type>(base) ||
+           ratio * divisor_next > rest * base + window[divisor_cnt - 2]) {
+      --ratio;
+      rest += divisor_high;
+
+      if (rest >= static_cast<wide_type>(base)) {
+        break;
+      }
+    }
+
+    wide_type borrow = 0;
+    carry = 0;
+
+    for (size_t index = 0; index < divisor_cnt; ++index) {
+      wide_type product = ratio * divisor_norm[index] + carry;
+      carry = product / base;
+      wide_type current = static_cast<wide_type>(window[index]) + base - product % base - borrow;
+      borrow = current < base ? 1 : 0;
+      window[index] = static_cast<limb_type>(current - (1 - borrow) * base);
+    }
+
+    wide_type subtrahend = carry + borrow;
+
+    if (static_cast<wide_type>(window[divisor_cnt]) < subtrahend) {
+      --ratio;
+      carry = 0;
+
+      for (size_t index = 0; index < divisor_cnt; ++index) {
+        wide_type current = static_cast<wide_type>(window[index]) + divisor_norm[index] + carry;
+        carry = current >= base ? 1 : 0;
+        window[index] = static_cast<limb_type>(current - carry * base);
+      }
+
+      window[divisor_cnt] = static_cast<limb_type>(window[divisor_cnt] + carry - subtrahend);
+    } else {
+      window[divisor_cnt] = static_cast<limb_type>(window[divisor_cnt] - subtrahend);
+    }
+
+    quotient[shift - 1] = static_cast<limb_type>(ratio);
+  }
+
+  divideLimbsShort(dividend_norm.data(), divisor_cnt, factor, remainder);
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs> BasicBigInteger<Limbs>::reciprocalNewton(const BasicBigInteger& divisor) {
+  size_t count = divisor.digit_cnt_;
+  BasicBigInteger power(1);
+  power.shiftLimbs(2 * count);
+
+  if (count < std::max(newton_threshold / 4, static_cast<size_t>(4))) {
+    std::vector<limb_type> quotient(count + 2);
+    std::vector<limb_type> remainder(count);
+
+    divideLimbsKnuth(power.digits_.data(), power.digit_cnt_, divisor.digits_.data(), count,
+                     quotient.data(), remainder.data());
+
+    BasicBigInteger result;
+    result.fromLimbs(quotient.data(), quotient.size());
+    return result;
+  }
+
+  size_t high_cnt = count / 2 + 1;
+  BasicBigInteger divisor_high(divisor);
+  divisor_high.removeLowLimbs(count - high_cnt);
+
+  BasicBigInteger result(reciprocalNewton(divisor_high));
+  result.shiftLimbs(count - high_cnt);
+
+  BasicBigInteger product(divisor);
+  product *= result;
+
+  BasicBigInteger error(power);
+  error -= product;
+  error *= result;
+  error.removeLowLimbs(2 * count);
+  result += error;
+
+  product = divisor;
+  product *= result;
+
+  while (product > power) {
+    --result;
+    product -= divisor;
+  }
+
+  product += divisor;
+
+  while (product <= power) {
+    ++result;
+    product += divisor;
+  }
+
+  return result;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs> BasicBigInteger<Limbs>::divisionByReciprocal(BasicBigInteger& dividend,
+                                                                    const BasicBigInteger& divisor,
+                                                                    const BasicBigInteger& reciprocal) {
+  BasicBigInteger quotient(dividend);
+  quotient.removeLowLimbs(divisor.digit_cnt_ - 1);
+  quotient *= reciprocal;
+  quotient.removeLowLimbs(divisor.digit_cnt_ + 1);
+
+  BasicBigInteger product(quotient);
+  product *= divisor;
+  dividend -= product;
+
+  while (dividend >= divisor) {
+    dividend -= divisor;
+    ++quotient;
+  }
+
+  return quotient;
+}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::divideLimbsNewton(const limb_type* dividend, size_t dividend_cnt,
+                                               const limb_type* divisor, size_t divisor_cnt,
+                                               limb_type* quotient, limb_type* remainder) {
+  wide_type factor = base / (static_cast<wide_type>(divisor[divisor_cnt - 1]) + 1);
+  BasicBigInteger divisor_norm;
+  divisor_norm.fromLimbs(divisor, divisor_cnt);
+  divisor_norm *= static_cast<long long>(factor);
+
+  BasicBigInteger dividend_norm;
+  dividend_norm.fromLimbs(dividend, dividend_cnt);
+  dividend_norm *= static_cast<long long>(factor);
+
+  BasicBigInteger reciprocal(reciprocalNewton(divisor_norm));
+  BasicBigInteger rest;
+  BasicBigInteger block;
+  size_t end = dividend_norm.digit_cnt_;
+
+  std::fill(quotient, quotient + dividend_cnt - divisor_cnt + 1, 0);
+
+  while (end > 0) {
+    size_t begin = end > divisor_cnt ? end - divisor_cnt : 0;
+    block.fromLimbs(dividend_norm.digits_.data() + begin, end - begin);
+    rest.shiftLimbs(end - begin);
+    rest += block;
+
+    BasicBigInteger block_quotient(divisionByReciprocal(rest, divisor_norm, reciprocal));
+    std::copy(block_quotient.digits_.begin(), block_quotient.digits_.end(), quotient + begin);
+    end = begin;
+  }
+
+  std::fill(remainder, remainder + divisor_cnt, 0);
+  std::copy(rest.digits_.begin(), rest.digits_.end(), remainder);
+  divideLimbsShort(remainder, divisor_cnt, factor, remainder);
+}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::fromLimbs(const limb_type* limbs, size_t limb_cnt) {
+  while (limb_cnt > 0 && limbs[limb_cnt - 1] == 0) {
+    --limb_cnt;
+  }
+
+  digits_.assign(limbs, limbs + limb_cnt);
+  digit_cnt_ = limb_cnt;
+  sign_ = limb_cnt > 0 ? Sign::Positive : Sign::Zero;
+}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::writeChunk(char* out, wide_type value, size_t width) {
+  for (size_t index = width; index > 0; --index) {
+    out[index - 1] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  }
+}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::writeDecimalLeaf(const BasicBigInteger& value, char* out, size_t width) {
+  const size_t chunk_power = 9;
+  const wide_type chunk_base = 1e9;
+  char* end = out + width;
+
+  if constexpr (Limbs::radix == 10) {
+
+    for (size_t index = 0; index < value.digit_cnt_; ++index) {
+      end -= chunk_power;
+      writeChunk(end, value.digits_[index], chunk_power);
+    }
+
+  } else {
+
+    std::vector<limb_type> limbs(value.digits_.begin(), value.digits_.begin() + value.digit_cnt_);
+    size_t limb_cnt = limbs.size();
+
+    while (limb_cnt > 0) {
+      end -= chunk_power;
+      writeChunk(end, divideLimbsShort(limbs.data(), limb_cnt, chunk_base, limbs.data()), chunk_power);
+
+      while (limb_cnt > 0 && limbs[limb_cnt - 1] == 0) {
+        --limb_cnt;
+      }
+    }
+  }
+
+  std::fill(out, end, '0');
+}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::writeDecimalRecursive(const BasicBigInteger& value,
+                                                   const std::vector<BasicBigInteger>& powers,
+                                                   const std::vector<BasicBigInteger>& reciprocals,
+                                                   const std::vector<long long>& factors,
+                                                   size_t level, char* out) {
+  if (level == 0 || value.digit_cnt_ <= conversion_threshold) {
+    writeDecimalLeaf(value, out, static_cast<size_t>(9) << level);
+    return;
+  }
+
+  BasicBigInteger low(value);
+  low *= factors[level - 1];
+
+  BasicBigInteger high(divisionByReciprocal(low, powers[level - 1], reciprocals[level - 1]));
+  divideLimbsShort(low.digits_.data(), low.digit_cnt_, factors[level - 1], low.digits_.data());
+  low.removeLeadingZeros();
+
+  writeDecimalRecursive(high, powers, reciprocals, factors, level - 1, out);
+  writeDecimalRecursive(low, powers, reciprocals, factors, level - 1,
+                        out + (static_cast<size_t>(9) << (level - 1)));
+}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::writeDecimal(std::string& result) const {
+  size_t offset = result.size();
+
+  if (Limbs::radix == 10 || digit_cnt_ <= conversion_threshold) {
+    size_t width = 9 * ((digit_cnt_ * Limbs::decimal_width + 8) / 9);
+    result.resize(offset + width);
+    writeDecimalLeaf(*this, result.data() + offset, width);
+    return;
+  }
+
+  std::vector<BasicBigInteger> powers(1, BasicBigInteger(1000000000ll));
+
+  while (compareLimbs(digits_.data(), digit_cnt_, powers.back().digits_.data(),
+                      powers.back().digit_cnt_) >= 0) {
+    powers.push_back(powers.back() * powers.back());
+  }
+
+  std::vector<BasicBigInteger> reciprocals(powers.size() - 1);
+  std::vector<long long> factors(powers.size() - 1);
+
+  for (size_t level = 0; level + 1 < powers.size(); ++level) {
+    factors[level] = base / (static_cast<long long>(powers[level].getHighDigit()) + 1);
+    powers[level] *= factors[level];
+    reciprocals[level] = reciprocalNewton(powers[level]);
+  }
+
+  BasicBigInteger magnitude(*this);
+  magnitude.sign_ = Sign::Positive;
+
+  result.resize(offset + (static_cast<size_t>(9) << (powers.size() - 1)));
+  writeDecimalRecursive(magnitude, powers, reciprocals, factors, powers.size() - 1, result.data() + offset);
+}
+
+template <typename Limbs>
+typename BasicBigInteger<Limbs>::limb_type BasicBigInteger<Limbs>::getLimb(size_t index) const {
+  return index < digit_cnt_ ? digits_[index] : 0;
+}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::combineLimbs(const BasicBigInteger& first, long long first_factor,
+                                          const BasicBigInteger& second, long long second_factor,
+                                          std::vector<limb_type>& result) {
+  result.resize(first.digit_cnt_);
+  __int128 carry = 0;
+
+  for (size_t index = 0; index < first.digit_cnt_; ++index) {
+    carry += static_cast<__int128>(first_factor) * first.digits_[index] +
+             static_cast<__int128>(second_factor) * second.getLimb(index);
+
+    __int128 quotient = carry / base;
+    __int128 limb = carry - quotient * base;
+
+    if (limb < 0) {
+      limb += base;
+      --quotient;
+    }
+
+    result[index] = static_cast<limb_type>(limb);
+    carry = quotient;
+  }
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs> BasicBigInteger<Limbs>::gcd(const BasicBigInteger& first,
+                                                   const BasicBigInteger& second) {
+  BasicBigInteger first_temp(first);
+  BasicBigInteger second_temp(second);
+
+  if (!first_temp.isPositive() || !second_temp.isPositive()) {
+    std::cerr << "GCD wrong sign_s" << std::endl;
+    return BasicBigInteger();
+  }
+
+  if (first_temp < second_temp) {
+    first_temp.swap(second_temp);
+  }
+
+  std::vector<limb_type> first_buffer;
+  std::vector<limb_type> second_buffer;
+
+  while (second_temp.isPositive()) {
+    size_t count = first_temp.digit_cnt_;
+
+    if (count <= 2) {
+      wide_type first_value = static_cast<wide_type>(first_temp.getLimb(1)) * base + first_temp.getLimb(0);
+      wide_type second_value = static_cast<wide_type>(second_temp.getLimb(1)) * base + second_temp.getLimb(0);
+
+      while (second_value != 0) {
+        first_value %= second_value;
+        std::swap(first_value, second_value);
+      }
+
+      BasicBigInteger result;
+      result.sign_ = Sign::Positive;
+      result.assignMagnitude(first_value);
+      return result;
+    }
+
+    wide_type first_leading = static_cast<wide_type>(first_temp.getLimb(count - 1)) * base +
+                              first_temp.getLimb(count - 2);
+    wide_type second_leading = static_cast<wide_type>(second_temp.getLimb(count - 1)) * base +
+                               second_temp.getLimb(count - 2);
+
+    while (first_leading >> 62 != 0) {
+      first_leading >>= 1;
+      second_leading >>= 1;
+    }
+
+    long long first_high = static_cast<long long>(first_leading);
+    long long second_high = static_cast<long long>(second_leading);
+    long long factor_a = 1;
+    long long factor_b = 0;
+    long long factor_c = 0;
+    long long factor_d = 1;
+
+    while (second_high + factor_c != 0 && second_high + factor_d != 0) {
+      long long ratio = (first_high + factor_a) / (second_high + factor_c);
+
+      if (ratio != (first_high + factor_b) / (second_high + factor_d)) {
+        break;
+      }
+
+      long long temp = factor_a - ratio * factor_c;
+      factor_a = factor_c;
+      factor_c = temp;
+
+      temp = factor_b - ratio * factor_d;
+      factor_b = factor_d;
+      factor_d = temp;
+
+      temp = first_high - ratio * second_high;
+      first_high = second_high;
+      second_high = temp;
+    }
+
+    if (factor_b == 0) {
+      first_temp %= second_temp;
+      first_temp.swap(second_temp);
+      continue;
+    }
+
+    combineLimbs(first_temp, factor_a, second_temp, factor_b, first_buffer);
+    combineLimbs(first_temp, factor_c, second_temp, factor_d, second_buffer);
+    first_temp.fromLimbs(first_buffer.data(), first_buffer.size());
+    second_temp.fromLimbs(second_buffer.data(), second_buffer.size());
+  }
+
+  return first_temp;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs> BasicBigInteger<Limbs>::divisionPositive(BasicBigInteger& dividend,
+                                                                const BasicBigInteger& divisor) {
+  BasicBigInteger remainder;
+
+  if (dividend.isZero() || dividend.digit_cnt_ < divisor.digit_cnt_) {
+    remainder.swap(dividend);
+    return remainder;
+  }
+
+  std::vector<limb_type> quotient(dividend.digit_cnt_ - divisor.digit_cnt_ + 1);
+  std::vector<limb_type> remainder_limbs(divisor.digit_cnt_);
+
+  divideLimbs(dividend.digits_.data(), dividend.digit_cnt_, divisor.digits_.data(),
+              divisor.digit_cnt_, quotient.data(), remainder_limbs.data());
+
+  dividend.fromLimbs(quotient.data(), quotient.size());
+  remainder.fromLimbs(remainder_limbs.data(), remainder_limbs.size());
+
+  return remainder;
+}
+
+template <typename Limbs>
+Sign BasicBigInteger<Limbs>::signProduct(const BasicBigInteger& first, const BasicBigInteger& second) {
+  return first.sign_ * second.sign_;
+}
+
+template <typename Limbs>
+int BasicBigInteger<Limbs>::signum(Sign sign) {
+  if (sign == Sign::Zero) {
+    return 0;
+  }
+
+  return sign == Sign::Positive ? 1 : -1;
+}
+
+template <typename Limbs>
+int BasicBigInteger<Limbs>::compare(const BasicBigInteger& that, const BasicBigInteger& other) {
+  if (that.sign_ != other.sign_) {
+    return signum(that.sign_) < signum(other.sign_) ? -1 : 1;
+  }
+
+  int comparison = compareLimbs(that.digits_.data(), that.digit_cnt_,
+                                other.digits_.data(), other.digit_cnt_);
+
+  return that.isNegative() ? -comparison : comparison;
+}
+
+template <typename Limbs>
+int BasicBigInteger<Limbs>::compare(const BasicBigInteger& that, long long other) {
+  int other_sign = other > 0 ? 1 : (other < 0 ? -1 : 0);
+
+  if (signum(that.sign_) != other_sign) {
+    return signum(that.sign_) < other_sign ? -1 : 1;
+  }
+
+  if (that.digit_cnt_ > 3) {
+    return other_sign;
+  }
+
+  unsigned __int128 magnitude = 0;
+
+  for (size_t index = that.digit_cnt_; index > 0; --index) {
+    magnitude = magnitude * base + static_cast<unsigned __int128>(that.digits_[index - 1]);
+  }
+
+  unsigned long long other_magnitude = other > 0 ? other : 0ull - static_cast<unsigned long long>(other);
+
+  if (magnitude == other_magnitude) {
+    return 0;
+  }
+
+  return magnitude < other_magnitude ? -other_sign : other_sign;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs>& BasicBigInteger<Limbs>::operator=(BasicBigInteger&& source) noexcept(
+    std::is_nothrow_move_assignable_v<buffer_type>) {
+  if (this != &source) {
+    sign_ = source.sign_;
+    digit_cnt_ = source.digit_cnt_;
+    digits_ = std::move(source.digits_);
+    source.sign_ = Sign::Zero;
+    source.digit_cnt_ = 0;
+  }
+
+  return *this;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs>::BasicBigInteger(BasicBigInteger&& source) noexcept
+    : sign_(source.sign_), digit_cnt_(source.digit_cnt_), digits_(std::move(source.digits_)) {
+  source.sign_ = Sign::Zero;
+  source.digit_cnt_ = 0;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs>::BasicBigInteger(int source): BasicBigInteger(static_cast<long long>(source)) {}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::inverse() {
+  if (sign_ == Sign::Positive) {
+
+    sign_ = Sign::Negative;
+
+  } else if (sign_ == Sign::Negative) {
+
+    sign_ = Sign::Positive;
+
+  }
+}
+
+template <typename Limbs>
+size_t BasicBigInteger<Limbs>::getDigitCount() const {
+  return digit_cnt_;
+}
+
+template <typename Limbs>
+std::span<const typename BasicBigInteger<Limbs>::limb_type> BasicBigInteger<Limbs>::getDigits() const {
+  return std::span<const limb_type>(digits_.data(), digit_cnt_);
+}
+
+template <typename Limbs>
+bool BasicBigInteger<Limbs>::isZero() const {
+  return sign_ == Sign::Zero;
+}
+
+template <typename Limbs>
+bool BasicBigInteger<Limbs>::isPositive() const {
+  return sign_ == Sign::Positive;
+}
+
+template <typename Limbs>
+bool BasicBigInteger<Limbs>::isNegative() const {
+  return sign_ == Sign::Negative;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs>::BasicBigInteger(long long source): sign_(Sign::Zero), digit_cnt_(0) {
+  if (source > 0) {
+
+    sign_ = Sign::Positive;
+
+  } else if (source < 0) {
+
+    sign_ = Sign::Negative;
+
+  } else {
+
+    return;
+  }
+
+  assignMagnitude(source > 0 ? source : 0ull - static_cast<unsigned long long>(source));
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs>::BasicBigInteger(std::string_view source): sign_(Sign::Zero), digit_cnt_(0) {
+  source.remove_prefix(std::min(source.find_first_not_of(" \t\n\v\f\r"), source.size()));
+  bool negative = !source.empty() && source[0] == '-';
+
+  if (!source.empty() && (source[0] == '-' || source[0] == '+')) {
+    source.remove_prefix(1);
+  }
+
+  if (source.empty()) {
+    throw std::invalid_argument("exception: BigInteger: invalid digit");
+  }
+
+  size_t end = source.size();
+
+  if constexpr (Limbs::radix == 10) {
+
+    digits_.resize((end + base_power - 1) / base_power);
+
+    for (; end >= base_power; end -= base_power) {
+      digits_[digit_cnt_++] = static_cast<limb_type>(parseDigits(source.data() + end - base_power, base_power));
+    }
+
+    if (end != 0) {
+      digits_[digit_cnt_++] = static_cast<limb_type>(parseDigits(source.data(), end));
+    }
+
+    sign_ = Sign::Positive;
+    removeLeadingZeros();
+
+  } else {
+
+    const size_t chunk_power = 9;
+    std::vector<wide_type> chunks((end + chunk_power - 1) / chunk_power);
+
+    for (size_t index = chunks.size(); index > 0; --index, end -= chunk_power) {
+      size_t begin = index > 1 ? end - chunk_power : 0;
+      chunks[index - 1] = parseDigits(source.data() + begin, end - begin);
+    }
+
+    readDecimal(chunks.data(), chunks.size());
+  }
+
+  if (negative) {
+    inverse();
+  }
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs>::BasicBigInteger(const char* source, size_t size)
+    : BasicBigInteger(std::string_view(source, size)) {}
+
+template <typename Limbs>
+template <typename OtherLimbs>
+BasicBigInteger<Limbs>::BasicBigInteger(const BasicBigInteger<OtherLimbs>& source) {
+  if constexpr (OtherLimbs::base == Limbs::base) {
+
+    sign_ = source.sign_;
+    digit_cnt_ = source.digit_cnt_;
+    digits_.assign(source.digits_.data(), source.digits_.data() + source.digits_.size());
+    return;
+
+  } else if constexpr (Limbs::radix == 10) {
+
+    *this = BasicBigInteger(source.toString());
+    return;
+
+  } else if constexpr (OtherLimbs::base == 1000000000) {
+
+    std::vector<wide_type> chunks(source.digits_.rbegin(), source.digits_.rend());
+    readDecimal(chunks.data(), chunks.size());
+
+  } else {
+
+    for (size_t index = source.digit_cnt_; index > 0; --index) {
+      *this *= OtherLimbs::base;
+      *this += static_cast<long long>(source.digits_[index - 1]);
+    }
+  }
+
+  if (source.isNegative()) {
+    inverse();
+  }
+}
+
+template <typename Limbs>
+size_t BasicBigInteger<Limbs>::makeGreaterThan(const BasicBigInteger& other) {
+  if (*this >= other) {
+
+    return static_cast<size_t>(0);
+  }
+
+  size_t digit_diff = other.digit_cnt_ - digit_cnt_;
+  shiftLimbs(digit_diff);
+
+  if (*this < other) {
+    shiftLimbs(static_cast<size_t>(1));
+    ++digit_diff;
+  }
+
+  return digit_diff;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs>::operator bool() const {
+  return sign_ != Sign::Zero;
+}
+
+template <typename Limbs>
+typename BasicBigInteger<Limbs>::wide_type BasicBigInteger<Limbs>::parseEightDigits(const char* source) {
+  const wide_type high_mask = 0xF0F0F0F0F0F0F0F0ull;
+  wide_type chunk = 0;
+
+  for (size_t index = 0; index < 8; ++index) {
+    chunk |= static_cast<wide_type>(static_cast<unsigned char>(source[index])) << (8 * index);
+  }
+
+  if (((chunk & high_mask) | (((chunk + 0x0606060606060606ull) & high_mask) >> 4)) != 0x3333333333333333ull) {
+    throw std::invalid_argument("exception: BigInteger: invalid digit");
+  }
+
+  chunk -= 0x3030303030303030ull;
+  chunk = (chunk * 10 + (chunk >> 8)) & 0x00FF00FF00FF00FFull;
+  chunk = (chunk * 100 + (chunk >> 16)) & 0x0000FFFF0000FFFFull;
+  chunk = (chunk * 10000 + (chunk >> 32)) & 0x00000000FFFFFFFFull;
+  return chunk;
+}
+
+template <typename Limbs>
+typename BasicBigInteger<Limbs>::wide_type BasicBigInteger<Limbs>::parseDigits(const char* source, size_t size) {
+  wide_type result = 0;
+  size_t index = 0;
+
+  for (; index + 8 <= size; index += 8) {
+    result = result * 100000000 + parseEightDigits(source + index);
+  }
+
+  for (; index < size; ++index) {
+    wide_type digit = static_cast<unsigned char>(source[index]) - static_cast<wide_type>('0');
+
+    if (digit > 9) {
+      throw std::invalid_argument("exception: BigInteger: invalid digit");
+    }
+
+    result = result * 10 + digit;
+  }
+
+  return result;
+}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::multiplyAddLimb(wide_type factor, wide_type addend) {
+  for (size_t index = 0; index < digit_cnt_; ++index) {
+    addend += static_cast<wide_type>(digits_[index]) * factor;
+    digits_[index] = static_cast<limb_type>(addend % base);
+    addend /= base;
+  }
+
+  for (; addend > 0; addend /= base) {
+    digits_.push_back(static_cast<limb_type>(addend % base));
+    ++digit_cnt_;
+  }
+
+  if (digit_cnt_ > 0) {
+    sign_ = Sign::Positive;
+  }
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs> BasicBigInteger<Limbs>::readDecimalRecursive(const wide_type* chunks, size_t chunk_cnt,
+                                                                    const std::vector<BasicBigInteger>& powers,
+                                                                    size_t level) {
+  BasicBigInteger result;
+
+  if (level == 0 || chunk_cnt <= conversion_threshold) {
+
+    for (size_t index = 0; index < chunk_cnt; ++index) {
+      result.multiplyAddLimb(1000000000, chunks[index]);
+    }
+
+    return result;
+  }
+
+  size_t low_cnt = static_cast<size_t>(1) << (level - 1);
+
+  if (chunk_cnt <= low_cnt) {
+    return readDecimalRecursive(chunks, chunk_cnt, powers, level - 1);
+  }
+
+  result = readDecimalRecursive(chunks, chunk_cnt - low_cnt, powers, level - 1);
+  result *= powers[level - 1];
+  result += readDecimalRecursive(chunks + chunk_cnt - low_cnt, low_cnt, powers, level - 1);
+  return result;
+}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::readDecimal(const wide_type* chunks, size_t chunk_cnt) {
+  std::vector<BasicBigInteger> powers(1, BasicBigInteger(1000000000ll));
+
+  while (chunk_cnt > conversion_threshold && (static_cast<size_t>(1) << powers.size()) < chunk_cnt) {
+    powers.push_back(powers.back() * powers.back());
+  }
+
+  *this = readDecimalRecursive(chunks, chunk_cnt, powers, powers.size());
+}
+
+template <typename Limbs>
+std::string BasicBigInteger<Limbs>::toString() const {
+  if (sign_ == Sign::Zero) {
+
+    return std::string(1, '0');
+  }
+
+  std::string result;
+  size_t sign_cnt = sign_ == Sign::Negative ? 1 : 0;
+
+  if (sign_ == Sign::Negative) {
+    result += '-';
+  }
+
+  writeDecimal(result);
+  result.erase(sign_cnt, result.find_first_not_of('0', sign_cnt) - sign_cnt);
+
+  return result;
+}
+
+template <typename Limbs>
+std::string BasicBigInteger<Limbs>::toFullString() const {
+  std::string result;
+
+  if (sign_ == Sign::Zero) {
+    return result;
+  }
+
+  if (sign_ == Sign::Negative) {
+    result += '-';
+  }
+
+  writeDecimal(result);
+  return result;
+}
+
+template <typename Limbs>
+size_t BasicBigInteger<Limbs>::serializedSize() const {
+  return bigint::serial::header_size + digit_cnt_ * bigint::serial::limb_size;
+}
+
+template <typename Limbs>
+size_t BasicBigInteger<Limbs>::serialize(std::span<std::byte> out) const {
+  size_t size = serializedSize();
+
+  if (out.size() < size) {
+    std::cerr << "Error: serialization buffer is too small!\n";
+    return 0;
+  }
+
+  uint64_t header = static_cast<uint64_t>(digit_cnt_) << bigint::serial::count_shift;
+
+  if (sign_ == Sign::Negative) {
+    header |= bigint::serial::negative_flag;
+  }
+
+  if (Limbs::radix == 2) {
+    header |= bigint::serial::binary_flag;
+  }
+
+  bigint::serial::store(out.data(), header, bigint::serial::header_size);
+  std::byte* limbs = out.data() + bigint::serial::header_size;
+
+  if constexpr (std::endian::native == std::endian::little && sizeof(limb_type) == bigint::serial::limb_size) {
+    std::memcpy(limbs, digits_.data(), digit_cnt_ * bigint::serial::limb_size);
+  } else {
+    for (size_t index = 0; index < digit_cnt_; ++index) {
+      bigint::serial::store(limbs + index * bigint::serial::limb_size, static_cast<uint64_t>(digits_[index]),
+                            bigint::serial::limb_size);
+    }
+  }
+
+  return size;
+}
+
+template <typename Limbs>
+std::vector<std::byte> BasicBigInteger<Limbs>::serialize() const {
+  std::vector<std::byte> result(serializedSize());
+  serialize(result);
+  return result;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs> BasicBigInteger<Limbs>::deserialize(std::span<const std::byte> source) {
+  return BasicBigIntegerView<Limbs>(source).value();
+}
+
+template <typename Limbs>
+size_t BasicBigInteger<Limbs>::hash() const {
+  using bigint::hashing::mix;
+  using bigint::hashing::pack;
+  using bigint::hashing::secret;
+
+  const limb_type* limbs = digits_.data();
+  uint64_t seed = mix(secret[0] ^ static_cast<uint64_t>(sign_), secret[1] ^ digit_cnt_);
+  size_t index = 0;
+
+  for (; index + 4 <= digit_cnt_; index += 4) {
+    seed = mix(pack(limbs[index], limbs[index + 1]) ^ secret[1],
+               pack(limbs[index + 2], limbs[index + 3]) ^ seed);
+  }
+
+  uint64_t tail[4] = {0, 0, 0, 0};
+  std::copy(limbs + index, limbs + digit_cnt_, tail);
+
+  seed = mix(pack(tail[0], tail[1]) ^ secret[2], pack(tail[2], tail[3]) ^ seed);
+  return mix(seed ^ secret[3], digit_cnt_ ^ secret[1]);
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs> BasicBigInteger<Limbs>::operator-() const& {
+  BasicBigInteger result(*this);
+  result.inverse();
+  return result;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs> BasicBigInteger<Limbs>::operator-() && {
+  inverse();
+  return std::move(*this);
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs>& BasicBigInteger<Limbs>::operator+=(const BasicBigInteger& other) {
+  if (isZero()) {
+
+    *this = other;
+    return *this;
+  }
+
+  if (other.isZero()) {
+    return *this;
+  }
+
+  if (this == &other) {
+    *this *= 2ll;
+    return *this;
+  }
+
+  if (sign_ == other.sign_) {
+
+    digit_cnt_ = std::max(digit_cnt_, other.digit_cnt_) + 1;
+    digits_.resize(digit_cnt_, 0);
+    addLimbs(digits_.data(), digit_cnt_, other.digits_.data(), other.digit_cnt_);
+
+  } else {
+
+    int comparison = compareLimbs(digits_.data(), digit_cnt_, other.digits_.data(), other.digit_cnt_);
+
+    if (comparison == 0) {
+      *this = BasicBigInteger();
+      return *this;
+    }
+
+    if (comparison > 0) {
+
+      subtractLimbs(digits_.data(), digit_cnt_, other.digits_.data(), other.digit_cnt_);
+
+    } else {
+
+      buffer_type difference(other.digits_.begin(), other.digits_.begin() + other.digit_cnt_);
+      subtractLimbs(difference.data(), other.digit_cnt_, digits_.data(), digit_cnt_);
+      digits_.swap(difference);
+      digit_cnt_ = other.digit_cnt_;
+      sign_ = other.sign_;
+    }
+  }
+
+  removeLeadingZeros();
+  return *this;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs>& BasicBigInteger<Limbs>::operator+=(long long other) {
+  if (other == 0) {
+    return *this;
+  }
+
+  Sign other_sign = other > 0 ? Sign::Positive : Sign::Negative;
+
+  if (sign_ != other_sign || other >= base || other <= -base) {
+    *this += BasicBigInteger(other);
+    return *this;
+  }
+
+  limb_type magnitude = static_cast<limb_type>(other > 0 ? other : -other);
+  digits_.push_back(0);
+  ++digit_cnt_;
+  addLimbs(digits_.data(), digit_cnt_, &magnitude, 1);
+  removeLeadingZeros();
+
+  return *this;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs> BasicBigInteger<Limbs>::operator++(int) {
+  BasicBigInteger copy(*this);
+  *this += 1ll;
+  return copy;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs>& BasicBigInteger<Limbs>::operator++() {
+  *this += 1ll;
+  return *this;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs> BasicBigInteger<Limbs>::operator--(int) {
+  BasicBigInteger copy(*this);
+  *this += -1ll;
+  return copy;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs>& BasicBigInteger<Limbs>::operator--() {
+  *this += -1ll;
+  return *this;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs>& BasicBigInteger<Limbs>::operator-=(const BasicBigInteger& other) {
+  if (this == &other) {
+    *this = BasicBigInteger();
+    return *this;
+  }
+
+  inverse();
+  *this += other;
+  inverse();
+
+  return *this;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs>& BasicBigInteger<Limbs>::operator*=(const BasicBigInteger& other) {
+  if (this == &other) {
+    return square();
+  }
+
+  BasicBigInteger result;
+
+  if (sign_ * other.sign_ == Sign::Zero) {
+    *this = BasicBigInteger();
+    return *this;
+  }
+
+  result.sign_ = sign_ * other.sign_;
+  result.digit_cnt_ = digit_cnt_ + other.digit_cnt_;
+  result.digits_.resize(result.digit_cnt_, 0);
+
+  multiplyLimbs(digits_.data(), digit_cnt_, other.digits_.data(), other.digit_cnt_,
+                result.digits_.data());
+
+  if (result.getHighDigit() == 0) {
+    result.digits_.pop_back();
+    --result.digit_cnt_;
+  }
+
+  swap(result);
+  return *this;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs>& BasicBigInteger<Limbs>::square() {
+  if (isZero()) {
+    return *this;
+  }
+
+  BasicBigInteger result;
+  result.sign_ = Sign::Positive;
+  result.digit_cnt_ = 2 * digit_cnt_;
+  result.digits_.resize(result.digit_cnt_, 0);
+
+  squareLimbs(digits_.data(), digit_cnt_, result.digits_.data());
+
+  if (result.getHighDigit() == 0) {
+    result.digits_.pop_back();
+    --result.digit_cnt_;
+  }
+
+  swap(result);
+  return *this;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs>& BasicBigInteger<Limbs>::operator*=(long long other) {
+  if (sign_ == Sign::Zero || other == 0LL) {
+
+    *this = BasicBigInteger();
+    return *this;
+  }
+
+  if (other >= base || other <= -base) {
+    *this *= BasicBigInteger(other);
+    return *this;
+  }
+
+  if (other < 0) {
+    inverse();
+    other = -other;
+  }
+
+  buffer_type high;
+  high.resize(digit_cnt_);
+  digits_.push_back(0);
+
+  bigint::simd::LimbKernels<Limbs>::splitProduct(digits_.data(), digit_cnt_, other, digits_.data(), high.data());
+  addLimbs(digits_.data() + 1, digit_cnt_, high.data(), digit_cnt_);
+  ++digit_cnt_;
+  removeLeadingZeros();
+
+  return *this;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs>& BasicBigInteger<Limbs>::shiftLimbs(size_t count) {
+  if (isZero()) {
+    return *this;
+  }
+
+  digits_.insert(digits_.begin(), count, 0);
+  digit_cnt_ += count;
+  return *this;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs> BasicBigInteger<Limbs>::powerOfTwo(size_t exponent) {
+  BasicBigInteger<BinaryLimbs> power(1);
+  power <<= exponent;
+  return BasicBigInteger(power);
+}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::negateLimbs(limb_type* limbs, size_t count) {
+  bool carry = true;
+
+  for (size_t index = 0; index < count; ++index) {
+    limbs[index] = static_cast<limb_type>(~limbs[index] + (carry ? 1 : 0));
+    carry = carry && limbs[index] == 0;
+  }
+}
+
+template <typename Limbs>
+template <typename Operation>
+void BasicBigInteger<Limbs>::applyBitwise(const BasicBigInteger& other, Operation operation) {
+  if constexpr (Limbs::radix == 10) {
+
+    BasicBigInteger<BinaryLimbs> binary(*this);
+    binary.applyBitwise(BasicBigInteger<BinaryLimbs>(other), operation);
+    *this = BasicBigInteger(binary);
+
+  } else {
+
+    size_t count = std::max(digit_cnt_, other.digit_cnt_) + 1;
+    std::vector<limb_type> first(count, 0);
+    std::vector<limb_type> second(count, 0);
+    std::copy(digits_.begin(), digits_.end(), first.begin());
+    std::copy(other.digits_.begin(), other.digits_.end(), second.begin());
+
+    if (isNegative()) {
+      negateLimbs(first.data(), count);
+    }
+
+    if (other.isNegative()) {
+      negateLimbs(second.data(), count);
+    }
+
+    for (size_t index = 0; index < count; ++index) {
+      first[index] = static_cast<limb_type>(operation(first[index], second[index]));
+    }
+
+    bool negative = (first[count - 1] >> (base_power - 1)) != 0;
+
+    if (negative) {
+      negateLimbs(first.data(), count);
+    }
+
+    fromLimbs(first.data(), count);
+
+    if (negative) {
+      inverse();
+    }
+  }
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs>& BasicBigInteger<Limbs>::operator<<=(size_t shift) {
+  if (isZero() || shift == 0) {
+    return *this;
+  }
+
+  if constexpr (Limbs::radix == 10) {
+
+    *this *= powerOfTwo(shift);
+
+  } else {
+
+    size_t bit_shift = shift % base_power;
+
+    if (bit_shift != 0) {
+      limb_type carry = 0;
+
+      for (size_t index = 0; index < digit_cnt_; ++index) {
+        limb_type limb = digits_[index];
+        digits_[index] = static_cast<limb_type>(limb << bit_shift) | carry;
+        carry = static_cast<limb_type>(limb >> (base_power - bit_shift));
+      }
+
+      if (carry != 0) {
+        digits_.push_back(carry);
+        ++digit_cnt_;
+      }
+    }
+
+    shiftLimbs(shift / base_power);
+  }
+
+  return *this;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs>& BasicBigInteger<Limbs>::operator>>=(size_t shift) {
+  if (isZero() || shift == 0) {
+    return *this;
+  }
+
+  bool negative = isNegative();
+  bool inexact = false;
+
+  if constexpr (Limbs::radix == 10) {
+
+    BasicBigInteger remainder = divisionPositive(*this, powerOfTwo(shift));
+    inexact = !remainder.isZero();
+
+    if (negative) {
+      inverse();
+    }
+
+  } else {
+
+    size_t limb_shift = shift / base_power;
+    size_t bit_shift = shift % base_power;
+
+    if (negative) {
+      for (size_t index = 0; index < std::min(limb_shift, digit_cnt_) && !inexact; ++index) {
+        inexact = digits_[index] != 0;
+      }
+
+      if (limb_shift < digit_cnt_ && bit_shift != 0) {
+        inexact = inexact || static_cast<limb_type>(digits_[limb_shift] << (base_power - bit_shift)) != 0;
+      }
+    }
+
+    removeLowLimbs(limb_shift);
+
+    if (bit_shift != 0 && !isZero()) {
+      for (size_t index = 0; index + 1 < digit_cnt_; ++index) {
+        digits_[index] = static_cast<limb_type>(digits_[index] >> bit_shift) |
+                         static_cast<limb_type>(digits_[index + 1] << (base_power - bit_shift));
+      }
+
+      digits_[digit_cnt_ - 1] >>= bit_shift;
+      removeLeadingZeros();
+    }
+  }
+
+  if (negative && inexact) {
+    --*this;
+  }
+
+  return *this;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs>& BasicBigInteger<Limbs>::operator&=(const BasicBigInteger& other) {
+  if (isZero() || other.isZero()) {
+    *this = BasicBigInteger();
+    return *this;
+  }
+
+  applyBitwise(other, [](auto first, auto second) { return first & second; });
+  return *this;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs>& BasicBigInteger<Limbs>::operator|=(const BasicBigInteger& other) {
+  if (other.isZero() || this == &other) {
+    return *this;
+  }
+
+  applyBitwise(other, [](auto first, auto second) { return first | second; });
+  return *this;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs>& BasicBigInteger<Limbs>::operator^=(const BasicBigInteger& other) {
+  if (this == &other) {
+    *this = BasicBigInteger();
+    return *this;
+  }
+
+  applyBitwise(other, [](auto first, auto second) { return first ^ second; });
+  return *this;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs> BasicBigInteger<Limbs>::operator~() const {
+  BasicBigInteger result(*this);
+  result.inverse();
+  --result;
+  return result;
+}
+
+template <typename Limbs>
+size_t BasicBigInteger<Limbs>::bitLength() const {
+  if constexpr (Limbs::radix == 10) {
+    return BasicBigInteger<BinaryLimbs>(*this).bitLength();
+  } else {
+    return isZero() ? 0 : (digit_cnt_ - 1) * base_power + std::bit_width(getHighDigit());
+  }
+}
+
+template <typename Limbs>
+size_t BasicBigInteger<Limbs>::popcount() const {
+  if constexpr (Limbs::radix == 10) {
+    return BasicBigInteger<BinaryLimbs>(*this).popcount();
+  } else {
+    size_t result = 0;
+
+    for (limb_type limb : digits_) {
+      result += std::popcount(limb);
+    }
+
+    return result;
+  }
+}
+
+template <typename Limbs>
+bool BasicBigInteger<Limbs>::testBit(size_t index) const {
+  if constexpr (Limbs::radix == 10) {
+    return BasicBigInteger<BinaryLimbs>(*this).testBit(index);
+  } else {
+    size_t limb_index = index / base_power;
+    limb_type limb = getLimb(limb_index);
+
+    if (isNegative()) {
+      size_t low_index = 0;
+
+      while (digits_[low_index] == 0) {
+        ++low_index;
+      }
+
+      if (limb_index < low_index) {
+        return false;
+      }
+
+      limb = static_cast<limb_type>(limb_index == low_index ? ~limb + 1 : ~limb);
+    }
+
+    return ((limb >> (index % base_power)) & 1) != 0;
+  }
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs>& BasicBigInteger<Limbs>::operator/=(const BasicBigInteger& other) {
+  if (other.sign_ * sign_ == Sign::Zero) {
+    *this = BasicBigInteger();
+
+    if (other.isZero()) {
+      std::cerr << "Error: division by zero!\n";
+    }
+
+    return *this;
+  }
+
+  if (sign_ * other.sign_ == Sign::Positive) {
+
+    if (*this == other) {
+      *this = BasicBigInteger(1);
+      return *this;
+    }
+
+    if ((*this < other) ^ (sign_ == Sign::Negative)) {
+      *this = BasicBigInteger();
+      return *this;
+    }
+
+    BasicBigInteger divisor(other);
+
+    if (sign_ == Sign::Negative) {
+      inverse();
+      divisor.inverse();
+    }
+
+    divisionPositive(*this, divisor);
+    return *this;
+  }
+
+  inverse();
+  *this /= other;
+  inverse();
+
+  return *this;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs>& BasicBigInteger<Limbs>::operator%=(const BasicBigInteger& other) {
+  if (other.isZero()) {
+    std::cerr << "Error: division by zero!\n";
+    *this = BasicBigInteger();
+    return *this;
+  }
+
+  if (isZero()) {
+    return *this;
+  }
+
+  bool isNeg = isNegative();
+  BasicBigInteger divisor(other);
+
+  if (other.isNegative()) {
+    divisor.inverse();
+  }
+
+  if (isNeg) {
+    inverse();
+  }
+
+  *this = divisionPositive(*this, divisor);
+
+  if (isNeg) {
+    inverse();
+  }
+
+  return *this;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs>& BasicBigInteger<Limbs>::operator/=(long long other) {
+  if (other == 0) {
+    std::cerr << "Error: division by zero!\n";
+    *this = BasicBigInteger();
+    return *this;
+  }
+
+  divmod(other > 0 ? other : 0ull - static_cast<unsigned long long>(other));
+
+  if (other < 0) {
+    inverse();
+  }
+
+  return *this;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs>& BasicBigInteger<Limbs>::operator%=(long long other) {
+  if (other == 0) {
+    std::cerr << "Error: division by zero!\n";
+    *this = BasicBigInteger();
+    return *this;
+  }
+
+  wide_type divisor = other > 0 ? other : 0ull - static_cast<unsigned long long>(other);
+  wide_type remainder = divideLimbsWord(digits_.data(), digit_cnt_, divisor, nullptr);
+  Sign sign = sign_;
+
+  assignMagnitude(remainder);
+  sign_ = remainder == 0 ? Sign::Zero : sign;
+  return *this;
+}
+
+template <typename Limbs>
+uint64_t BasicBigInteger<Limbs>::divmod(uint64_t divisor) {
+  if (divisor == 0) {
+    std::cerr << "Error: division by zero!\n";
+    *this = BasicBigInteger();
+    return 0;
+  }
+
+  wide_type remainder = divideLimbsWord(digits_.data(), digit_cnt_, divisor, digits_.data());
+  removeLeadingZeros();
+  return remainder;
+}
+
+template <typename Limbs>
+std::vector<uint64_t> BasicBigInteger<Limbs>::residues(std::span<const uint64_t> moduli) const {
+  std::vector<uint64_t> result(moduli.size(), 0);
+  std::vector<wide_type> reciprocals(moduli.size(), 0);
+  std::vector<size_t> batched;
+
+  for (size_t index = 0; index < moduli.size(); ++index) {
+    if (moduli[index] == 0) {
+      std::cerr << "Error: division by zero!\n";
+    } else if (moduli[index] > ~static_cast<wide_type>(0) / base) {
+      result[index] = divideLimbsWord(digits_.data(), digit_cnt_, moduli[index], nullptr);
+    } else {
+      reciprocals[index] = ~static_cast<wide_type>(0) / moduli[index];
+      batched.push_back(index);
+    }
+  }
+
+  for (size_t index = digit_cnt_; index > 0; --index) {
+    wide_type limb = digits_[index - 1];
+
+    for (size_t position : batched) {
+      wide_type divisor = moduli[position];
+      wide_type current = result[position] * base + limb;
+      wide_type digit = static_cast<wide_type>((static_cast<unsigned __int128>(current) * reciprocals[position]) >> 64);
+      wide_type remainder = current - digit * divisor;
+
+      while (remainder >= divisor) {
+        remainder -= divisor;
+      }
+
+      result[position] = remainder;
+    }
+  }
+
+  if (isNegative()) {
+    for (size_t index = 0; index < moduli.size(); ++index) {
+      if (result[index] != 0) {
+        result[index] = moduli[index] - result[index];
+      }
+    }
+  }
+
+  return result;
+}
+
+template <typename Limbs>
+long double BasicBigInteger<Limbs>::logTwo() const {
+  size_t used = std::min(digit_cnt_, static_cast<size_t>(3));
+  long double mantissa = 0;
+
+  for (size_t index = 1; index <= used; ++index) {
+    mantissa = mantissa * base + digits_[digit_cnt_ - index];
+  }
+
+  return std::log2(mantissa) + static_cast<long double>(digit_cnt_ - used) * std::log2(static_cast<long double>(base));
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs> BasicBigInteger<Limbs>::power(const BasicBigInteger& value, size_t exponent) {
+  BasicBigInteger result(1);
+
+  for (size_t bit = std::bit_width(exponent); bit > 0; --bit) {
+    result.square();
+
+    if (((exponent >> (bit - 1)) & 1) != 0) {
+      result *= value;
+    }
+  }
+
+  return result;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs> BasicBigInteger<Limbs>::rootEstimate(const BasicBigInteger& value, size_t degree) {
+  long double log_root = value.logTwo() / degree + 1e-9L;
+  long double log_base = std::log2(static_cast<long double>(base));
+  size_t shift = log_root > 62 ? static_cast<size_t>(std::ceil((log_root - 62) / log_base)) : 0;
+
+  BasicBigInteger result(static_cast<long long>(std::ceil(std::exp2(log_root - shift * log_base))) + 1);
+  result.shiftLimbs(shift);
+  return result;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs> BasicBigInteger<Limbs>::rootStep(const BasicBigInteger& value, const BasicBigInteger& root,
+                                                        const BasicBigInteger& partial, size_t degree) {
+  BasicBigInteger result(root);
+  result *= static_cast<long long>(degree - 1);
+  result += value / partial;
+  result /= static_cast<long long>(degree);
+  return result;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs> BasicBigInteger<Limbs>::rootNewton(const BasicBigInteger& value, size_t degree) {
+  size_t shift = value.digit_cnt_ / (2 * degree);
+
+  if (shift < 2) {
+    BasicBigInteger root(rootEstimate(value, degree));
+    root = rootStep(value, root, power(root, degree - 1), degree);
+
+    while (true) {
+      BasicBigInteger next(rootStep(value, root, power(root, degree - 1), degree));
+
+      if (next >= root) {
+        return root;
+      }
+
+      root.swap(next);
+    }
+  }
+
+  --shift;
+  BasicBigInteger high(value);
+  high.removeLowLimbs(degree * shift);
+
+  BasicBigInteger root(rootNewton(high, degree));
+  root.shiftLimbs(shift);
+  return rootStep(value, root, power(root, degree - 1), degree);
+}
+
+template <typename Limbs>
+bool BasicBigInteger<Limbs>::isPrimeWord(wide_type value) {
+  if (value < 2) {
+    return false;
+  }
+
+  for (wide_type small : {2, 3, 5, 7, 11, 13, 61}) {
+    if (value % small == 0) {
+      return value == small;
+    }
+  }
+
+  wide_type odd = value - 1;
+  size_t twos = 0;
+
+  while (odd % 2 == 0) {
+    odd /= 2;
+    ++twos;
+  }
+
+  for (wide_type witness : {2, 7, 61}) {
+    wide_type current = powerModulo(witness, odd, value);
+    bool composite = current != 1 && current != value - 1;
+
+    for (size_t round = 1; round < twos && composite; ++round) {
+      current = current * current % value;
+      composite = current != value - 1;
+    }
+
+    if (composite) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template <typename Limbs>
+bool BasicBigInteger<Limbs>::isPowerResidue(const BasicBigInteger& value, size_t degree) {
+  std::vector<uint64_t> primes;
+
+  for (wide_type prime = 2 * degree + 1; primes.size() < 4 && prime < (static_cast<wide_type>(1) << 32);
+       prime += 2 * degree) {
+    if (isPrimeWord(prime)) {
+      primes.push_back(prime);
+    }
+  }
+
+  std::vector<uint64_t> remainders = value.residues(primes);
+
+  for (size_t index = 0; index < primes.size(); ++index) {
+    if (remainders[index] != 0 && powerModulo(remainders[index], (primes[index] - 1) / degree, primes[index]) != 1) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs> BasicBigInteger<Limbs>::isqrt() const {
+  return iroot(2);
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs> BasicBigInteger<Limbs>::iroot(size_t degree) const {
+  if (degree == 0) {
+    std::cerr << "Error: root of zero degree!\n";
+    return BasicBigInteger();
+  }
+
+  if (isNegative() && degree % 2 == 0) {
+    std::cerr << "Error: even root of negative number!\n";
+    return BasicBigInteger();
+  }
+
+  if (isZero() || degree == 1) {
+    return *this;
+  }
+
+  BasicBigInteger magnitude(*this);
+
+  if (isNegative()) {
+    magnitude.inverse();
+  }
+
+  BasicBigInteger root(1);
+
+  if (magnitude.logTwo() + 1 >= degree) {
+    root = rootNewton(magnitude, degree);
+
+    while (true) {
+      BasicBigInteger partial(power(root, degree - 1));
+
+      if (partial * root <= magnitude) {
+        break;
+      }
+
+      root = rootStep(magnitude, root, partial, degree);
+    }
+  }
+
+  if (isNegative()) {
+    root.inverse();
+  }
+
+  return root;
+}
+
+template <typename Limbs>
+bool BasicBigInteger<Limbs>::isPerfectPower() const {
+  if (isZero() || (digit_cnt_ == 1 && digits_[0] == 1)) {
+    return true;
+  }
+
+  BasicBigInteger magnitude(*this);
+
+  if (isNegative()) {
+    magnitude.inverse();
+  }
+
+  const wide_type modulus = 4294967291ull;
+  wide_type residue = divideLimbsWord(magnitude.digits_.data(), magnitude.digit_cnt_, modulus, nullptr);
+  long double log_value = magnitude.logTwo();
+
+  for (size_t degree : primesUpTo(static_cast<size_t>(log_value) + 1)) {
+    if (isNegative() && degree == 2) {
+      continue;
+    }
+
+    long double log_root = log_value / degree;
+
+    if (log_root < 32) {
+      wide_type estimate = static_cast<wide_type>(std::llround(std::exp2(log_root)));
+
+      for (wide_type root = std::max(estimate, static_cast<wide_type>(3)) - 1; root <= estimate + 1; ++root) {
+        if (powerModulo(root, degree, modulus) == residue &&
+            power(BasicBigInteger(static_cast<long long>(root)), degree) == magnitude) {
+          return true;
+        }
+      }
+
+    } else if (isPowerResidue(magnitude, degree)) {
+
+      BasicBigInteger root(magnitude.iroot(degree));
+
+      if (power(root, degree) == magnitude) {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+template <typename Limbs>
+std::vector<size_t> BasicBigInteger<Limbs>::primesUpTo(size_t limit) {
+  std::vector<size_t> primes;
+  std::vector<bool> composite(limit + 1, false);
+
+  for (size_t value = 2; value <= limit; ++value) {
+    if (composite[value]) {
+      continue;
+    }
+
+    primes.push_back(value);
+
+    for (size_t multiple = value * value; multiple <= limit; multiple += value) {
+      composite[multiple] = true;
+    }
+  }
+
+  return primes;
+}
+
+template <typename Limbs>
+void BasicBigInteger<Limbs>::appendFactor(std::vector<long long>& factors, wide_type factor, size_t exponent) {
+  for (; exponent > 0; --exponent) {
+    if (factors.empty() || static_cast<wide_type>(factors.back()) > (~static_cast<wide_type>(0) >> 1) / factor) {
+      factors.push_back(1);
+    }
+
+    factors.back() *= static_cast<long long>(factor);
+  }
+}
+
+template <typename Limbs>
+template <typename Iterator>
+BasicBigInteger<Limbs> BasicBigInteger<Limbs>::product(Iterator first, Iterator last) {
+  std::vector<BasicBigInteger> values;
+
+  for (; first != last; ++first) {
+    values.emplace_back(*first);
+  }
+
+  if (values.empty()) {
+    return BasicBigInteger(1);
+  }
+
+  while (values.size() > 1) {
+    size_t half = (values.size() + 1) / 2;
+
+    for (size_t index = 0; index + 1 < values.size(); index += 2) {
+      values[index / 2] = std::move(values[index]) * values[index + 1];
+    }
+
+    if (values.size() % 2 == 1) {
+      values[half - 1] = std::move(values.back());
+    }
+
+    values.resize(half);
+  }
+
+  return std::move(values[0]);
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs> BasicBigInteger<Limbs>::oddSwing(size_t value, const std::vector<size_t>& primes) {
+  std::vector<long long> factors;
+
+  for (size_t index = 1; index < primes.size() && primes[index] <= value; ++index) {
+    size_t exponent = 0;
+
+    for (size_t quotient = value / primes[index]; quotient > 0; quotient /= primes[index]) {
+      exponent += quotient & 1;
+    }
+
+    appendFactor(factors, primes[index], exponent);
+  }
+
+  return product(factors.begin(), factors.end());
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs> BasicBigInteger<Limbs>::oddFactorial(size_t value, const std::vector<size_t>& primes) {
+  if (value < 3) {
+    return BasicBigInteger(1);
+  }
+
+  BasicBigInteger result(oddFactorial(value / 2, primes));
+  result.square();
+  result *= oddSwing(value, primes);
+  return result;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs> BasicBigInteger<Limbs>::factorial(size_t value) {
+  BasicBigInteger result(oddFactorial(value, primesUpTo(value)));
+  result <<= value - std::popcount(value);
+  return result;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs> BasicBigInteger<Limbs>::binomial(size_t total, size_t chosen) {
+  if (chosen > total) {
+    return BasicBigInteger();
+  }
+
+  chosen = std::min(chosen, total - chosen);
+  std::vector<long long> factors;
+
+  for (size_t prime : primesUpTo(total)) {
+    size_t exponent = 0;
+
+    for (size_t high = total / prime, low = chosen / prime, rest = (total - chosen) / prime; high > 0;
+         high /= prime, low /= prime, rest /= prime) {
+      exponent += high - low - rest;
+    }
+
+    appendFactor(factors, prime, exponent);
+  }
+
+  return product(factors.begin(), factors.end());
+}
+
+template <typename Limbs>
+std::ostream& operator<<(std::ostream& out, const BasicBigInteger<Limbs>& source) {
+  out << source.toString();
+  return out;
+}
+
+template <typename Limbs>
+std::istream& operator>>(std::istream& in, BasicBigInteger<Limbs>& target) {
+  std::string input;
+
+  if (in >> input) {
+    target = BasicBigInteger<Limbs>(input);
+  }
+
+  return in;
+}
+
+BigInteger operator""_bi(const char* source) {
+  return BigInteger(std::string_view(source));
+}
+
+template <typename Limbs>
+class BasicBigIntegerView {
+private:
+  const std::byte* limbs_ = nullptr;
+  size_t limb_cnt_ = 0;
+  Sign sign_ = Sign::Zero;
+  bool binary_ = false;
+
+  template <typename Target>
+  BasicBigInteger<Target> read() const;
+
+public:
+  BasicBigIntegerView() = default;
+
+  explicit BasicBigIntegerView(std::span<const std::byte> source);
+
+  Sign sign() const;
+
+  long long radix() const;
+
+  size_t limbCount() const;
+
+  uint32_t limb(size_t index) const;
+
+  size_t byteSize() const;
+
+  BasicBigInteger<Limbs> value() const;
+};
+
+using BigIntegerView = BasicBigIntegerView<DecimalLimbs>;
+
+using BinaryBigIntegerView = BasicBigIntegerView<BinaryLimbs>;
+
+template <typename Limbs>
+BasicBigIntegerView<Limbs>::BasicBigIntegerView(std::span<const std::byte> source) {
+  if (source.size() < bigint::serial::header_size) {
+    std::cerr << "Error: truncated serialized value!\n";
+    return;
+  }
+
+  uint64_t header = bigint::serial::load(source.data(), bigint::serial::header_size);
+  uint64_t limb_cnt = header >> bigint::serial::count_shift;
+
+  if (limb_cnt > (source.size() - bigint::serial::header_size) / bigint::serial::limb_size) {
+    std::cerr << "Error: truncated serialized value!\n";
+    return;
+  }
+
+  limbs_ = source.data() + bigint::serial::header_size;
+  limb_cnt_ = limb_cnt;
+  binary_ = (header & bigint::serial::binary_flag) != 0;
+
+  if (limb_cnt_ > 0) {
+    sign_ = (header & bigint::serial::negative_flag) != 0 ? Sign::Negative : Sign::Positive;
+  }
+}
+
+template <typename Limbs>
+template <typename Target>
+BasicBigInteger<Target> BasicBigIntegerView<Limbs>::read() const {
+  using target_limb = typename BasicBigInteger<Target>::limb_type;
+  BasicBigInteger<Target> result;
+  result.digits_.resize(limb_cnt_);
+
+  if constexpr (std::endian::native == std::endian::little && sizeof(target_limb) == bigint::serial::limb_size) {
+    std::memcpy(result.digits_.data(), limbs_, limb_cnt_ * bigint::serial::limb_size);
+  } else {
+    for (size_t index = 0; index < limb_cnt_; ++index) {
+      result.digits_[index] = static_cast<target_limb>(limb(index));
+    }
+  }
+
+  if constexpr (Target::radix == 10) {
+    for (size_t index = 0; index < limb_cnt_; ++index) {
+      if (result.digits_[index] >= Target::base) {
+        std::cerr << "Error: malformed serialized value!\n";
+        return BasicBigInteger<Target>();
+      }
+    }
+  }
+
+  result.digit_cnt_ = limb_cnt_;
+  result.sign_ = sign_;
+  result.removeLeadingZeros();
+  return result;
+}
+
+template <typename Limbs>
+Sign BasicBigIntegerView<Limbs>::sign() const {
+  return sign_;
+}
+
+template <typename Limbs>
+long long BasicBigIntegerView<Limbs>::radix() const {
+  return binary_ ? BinaryLimbs::radix : DecimalLimbs::radix;
+}
+
+template <typename Limbs>
+size_t BasicBigIntegerView<Limbs>::limbCount() const {
+  return limb_cnt_;
+}
+
+template <typename Limbs>
+uint32_t BasicBigIntegerView<Limbs>::limb(size_t index) const {
+  return static_cast<uint32_t>(bigint::serial::load(limbs_ + index * bigint::serial::limb_size,
+                                                    bigint::serial::limb_size));
+}
+
+template <typename Limbs>
+size_t BasicBigIntegerView<Limbs>::byteSize() const {
+  return bigint::serial::header_size + limb_cnt_ * bigint::serial::limb_size;
+}
+
+template <typename Limbs>
+BasicBigInteger<Limbs> BasicBigIntegerView<Limbs>::value() const {
+  if (binary_ == (Limbs::radix == 2)) {
+
+    return read<Limbs>();
+
+  } else if (binary_) {
+
+    return BasicBigInteger<Limbs>(read<BinaryLimbs>());
+
+  } else {
+
+    return BasicBigInteger<Limbs>(read<DecimalLimbs>());
+  }
+}
+
+template <typename Limbs>
+struct std::hash<BasicBigInteger<Limbs>> {
+  size_t operator()(const BasicBigInteger<Limbs>& value) const {
+    return value.hash();
+  }
+};
+
+template <size_t Bits>
+class FixedBigInteger {
+  static_assert(Bits > 0 && Bits % 64 == 0, "FixedBigInteger width must be a positive multiple of 64 bits");
+
+private:
+  using limb_type = uint64_t;
+  using wide_type = unsigned __int128;
+
+  static constexpr size_t limb_cnt = Bits / 64;
+
+  std::array<limb_type, limb_cnt> limbs_{};
+
+  constexpr bool isNegative() const;
+
+  constexpr size_t usedLimbs() const;
+
+  static constexpr limb_type divideWord(FixedBigInteger& value, limb_type divisor);
+
+  static constexpr void divideMagnitude(const FixedBigInteger& dividend, const FixedBigInteger& divisor,
+                                        FixedBigInteger& quotient, FixedBigInteger& remainder);
+
+  static constexpr void divideSigned(FixedBigInteger& dividend, const FixedBigInteger& divisor, bool keep_remainder);
+
+  static constexpr int compare(const FixedBigInteger& that, const FixedBigInteger& other);
+
+  template <size_t OtherBits>
+  friend class FixedBigInteger;
+
+public:
+  constexpr FixedBigInteger() = default;
+
+  constexpr FixedBigInteger(long long source);
+
+  explicit constexpr FixedBigInteger(std::string_view source);
+
+  template <size_t OtherBits>
+  explicit constexpr FixedBigInteger(const FixedBigInteger<OtherBits>& source);
+
+  template <typename Limbs>
+  explicit FixedBigInteger(const BasicBigInteger<Limbs>& source);
+
+  template <typename Limbs>
+  explicit operator BasicBigInteger<Limbs>() const;
+
+  explicit constexpr operator bool() const;
+
+  std::string toString() const;
+
+  constexpr FixedBigInteger operator-() const;
+
+  constexpr FixedBigInteger operator~() const;
+
+  constexpr FixedBigInteger& operator+=(const FixedBigInteger& other);
+
+  constexpr FixedBigInteger& operator-=(const FixedBigInteger& other);
+
+  constexpr FixedBigInteger& operator*=(const FixedBigInteger& other);
+
+  constexpr FixedBigInteger& operator/=(const FixedBigInteger& other);
+
+  constexpr FixedBigInteger& operator%=(const FixedBigInteger& other);
+
+  constexpr FixedBigInteger& operator++();
+
+  constexpr FixedBigInteger operator++(int);
+
+  constexpr FixedBigInteger& operator--();
+
+  constexpr FixedBigInteger operator--(int);
+
+  constexpr FixedBigInteger& operator<<=(size_t shift);
+
+  constexpr FixedBigInteger& operator>>=(size_t shift);
+
+  constexpr FixedBigInteger& operator&=(const FixedBigInteger& other);
+
+  constexpr FixedBigInteger& operator|=(const FixedBigInteger& other);
+
+  constexpr FixedBigInteger& operator^=(const FixedBigInteger& other);
+
+  friend constexpr std::strong_ordering operator<=>(const FixedBigInteger& that, const FixedBigInteger& other) {
+    return compare(that, other) <=> 0;
+  }
+
+  friend constexpr bool operator==(const FixedBigInteger& that, const FixedBigInteger& other) {
+    return that.limbs_ == other.limbs_;
+  }
+
+  friend constexpr FixedBigInteger operator+(FixedBigInteger first, const FixedBigInteger& second) {
+    first += second;
+    return first;
+  }
+
+  friend constexpr FixedBigInteger operator-(FixedBigInteger first, const FixedBigInteger& second) {
+    first -= second;
+    return first;
+  }
+
+  friend constexpr FixedBigInteger operator*(FixedBigInteger first, const FixedBigInteger& second) {
+    first *= second;
+    return first;
+  }
+
+  friend constexpr FixedBigInteger operator/(FixedBigInteger first, const FixedBigInteger& second) {
+    first /= second;
+    return first;
+  }
+
+  friend constexpr FixedBigInteger operator%(FixedBigInteger first, const FixedBigInteger& second) {
+    first %= second;
+    return first;
+  }
+
+  friend constexpr FixedBigInteger operator<<(FixedBigInteger first, size_t shift) {
+    first <<= shift;
+    return first;
+  }
+
+  friend constexpr FixedBigInteger operator>>(FixedBigInteger first, size_t shift) {
+    first >>= shift;
+    return first;
+  }
+
+  friend constexpr FixedBigInteger operator&(FixedBigInteger first, const FixedBigInteger& second) {
+    first &= second;
+    return first;
+  }
+
+  friend constexpr FixedBigInteger operator|(FixedBigInteger first, const FixedBigInteger& second) {
+    first |= second;
+    return first;
+  }
+
+  friend constexpr FixedBigInteger operator^(FixedBigInteger first, const FixedBigInteger& second) {
+    first ^= second;
+    return first;
+  }
+};
+
+using Int256 = FixedBigInteger<256>;
+
+using Int512 = FixedBigInteger<512>;
+
+template <size_t Bits>
+constexpr bool FixedBigInteger<Bits>::isNegative() const {
+  return (limbs_[limb_cnt - 1] >> 63) != 0;
+}
+
+template <size_t Bits>
+constexpr size_t FixedBigInteger<Bits>::usedLimbs() const {
+  size_t count = limb_cnt;
+
+  while (count > 0 && limbs_[count - 1] == 0) {
+    --count;
+  }
+
+  return count;
+}
+
+template <size_t Bits>
+constexpr typename FixedBigInteger<Bits>::limb_type FixedBigInteger<Bits>::divideWord(FixedBigInteger& value,
+                                                                                   limb_type divisor) {
+  wide_type remainder = 0;
+
+  for (size_t index = limb_cnt; index > 0; --index) {
+    wide_type current = (remainder << 64) | value.limbs_[index - 1];
+    value.limbs_[index - 1] = static_cast<limb_type>(current / divisor);
+    remainder = current % divisor;
+  }
+
+  return static_cast<limb_type>(remainder);
+}
+
+template <size_t Bits>
+constexpr void FixedBigInteger<Bits>::divideMagnitude(const FixedBigInteger& dividend, const FixedBigInteger& divisor,
+                                                      FixedBigInteger& quotient, FixedBigInteger& remainder) {
+  size_t dividend_cnt = dividend.usedLimbs();
+  size_t divisor_cnt = divisor.usedLimbs();
+  quotient = FixedBigInteger();
+  remainder = FixedBigInteger();
+
+  if (limb_cnt == 1 || divisor_cnt == 1) {
+    quotient = dividend;
+    remainder.limbs_[0] = divideWord(quotient, divisor.limbs_[0]);
+    return;
+  }
+
+  if (dividend_cnt < divisor_cnt) {
+    remainder = dividend;
+    return;
+  }
+
+  int shift = std::countl_zero(divisor.limbs_[divisor_cnt - 1]);
+  std::array<limb_type, limb_cnt + 1> numerator{};
+  std::array<limb_type, limb_cnt> denominator{};
+
+  for (size_t index = 0; index < divisor_cnt; ++index) {
+    denominator[index] = divisor.limbs_[index] << shift;
+
+    if (shift > 0 && index > 0) {
+      denominator[index] |= divisor.limbs_[index - 1] >> (64 - shift);
+    }
+  }
+
+  for (size_t index = 0; index < dividend_cnt; ++index) {
+    numerator[index] = dividend.limbs_[index] << shift;
+
+    if (shift > 0 && index > 0) {
+      numerator[index] |= dividend.limbs_[index - 1] >> (64 - shift);
+    }
+  }
+
+  if (shift > 0) {
+    numerator[dividend_cnt] = dividend.limbs_[dividend_cnt - 1] >> (64 - shift);
+  }
+
+  limb_type top = denominator[divisor_cnt - 1];
+  limb_type next = denominator[divisor_cnt - 2];
+
+  for (size_t position = dividend_cnt - divisor_cnt + 1; position > 0; --position) {
+    size_t offset = position - 1;
+    wide_type current = (static_cast<wide_type>(numerator[offset + divisor_cnt]) << 64) |
+                        numerator[offset + divisor_cnt - 1];
+    wide_type estimate = current / top;
+    wide_type rest = current % top;
+
+    while ((estimate >> 64) != 0 ||
+           estimate * next > ((rest << 64) | numerator[offset + divisor_cnt - 2])) {
+      --estimate;
+      rest += top;
+
+      if ((rest >> 64) != 0) {
+        break;
+      }
+    }
+
+    limb_type carry = 0;
+    limb_type borrow = 0;
+
+    for (size_t index = 0; index < divisor_cnt; ++index) {
+      wide_type product = estimate * denominator[index] + carry;
+      limb_type low = static_cast<limb_type>(product);
+      limb_type value = numerator[offset + index];
+      carry = static_cast<limb_type>(product >> 64);
+      numerator[offset + index] = value - low - borrow;
+      borrow = (value < low || value - low < borrow) ? 1 : 0;
+    }
+
+    limb_type value = numerator[offset + divisor_cnt];
+    numerator[offset + divisor_cnt] = value - carry - borrow;
+
+    if (value < carry || value - carry < borrow) {
+      --estimate;
+      carry = 0;
+
+      for (size_t index = 0; index < divisor_cnt; ++index) {
+        wide_type sum = static_cast<wide_type>(numerator[offset + index]) + denominator[index] + carry;
+        numerator[offset + index] = static_cast<limb_type>(sum);
+        carry = static_cast<limb_type>(sum >> 64);
       }
 
-      inverse();
+      numerator[offset + divisor_cnt] += carry;
+    }
+
+    quotient.limbs_[offset] = static_cast<limb_type>(estimate);
+  }
+
+  for (size_t index = 0; index < divisor_cnt; ++index) {
+    remainder.limbs_[index] = numerator[index] >> shift;
+
+    if (shift > 0) {
+      remainder.limbs_[index] |= numerator[index + 1] << (64 - shift);
+    }
+  }
+}
+
+template <size_t Bits>
+constexpr void FixedBigInteger<Bits>::divideSigned(FixedBigInteger& dividend, const FixedBigInteger& divisor,
+                                                   bool keep_remainder) {
+  if (!divisor) {
+    std::cerr << "Error: division by zero!\n";
+    dividend = FixedBigInteger();
+    return;
+  }
+
+  bool dividend_negative = dividend.isNegative();
+  bool divisor_negative = divisor.isNegative();
+  FixedBigInteger quotient;
+  FixedBigInteger remainder;
+
+  divideMagnitude(dividend_negative ? -dividend : dividend, divisor_negative ? -divisor : divisor,
+                  quotient, remainder);
+
+  if (keep_remainder) {
+    dividend = dividend_negative ? -remainder : remainder;
+  } else {
+    dividend = dividend_negative != divisor_negative ? -quotient : quotient;
+  }
+}
+
+template <size_t Bits>
+constexpr int FixedBigInteger<Bits>::compare(const FixedBigInteger& that, const FixedBigInteger& other) {
+  if (that.isNegative() != other.isNegative()) {
+    return that.isNegative() ? -1 : 1;
+  }
+
+  for (size_t index = limb_cnt; index > 0; --index) {
+    if (that.limbs_[index - 1] != other.limbs_[index - 1]) {
+      return that.limbs_[index - 1] < other.limbs_[index - 1] ? -1 : 1;
     }
   }
 
-  return *this;
+  return 0;
 }
 
-BigInteger& BigInteger::operator+=(long long other) {
-  if (other == 0){
-    return *this;
+template <size_t Bits>
+constexpr FixedBigInteger<Bits>::FixedBigInteger(long long source) {
+  limbs_.fill(source < 0 ? ~static_cast<limb_type>(0) : 0);
+  limbs_[0] = static_cast<limb_type>(source);
+}
+
+template <size_t Bits>
+constexpr FixedBigInteger<Bits>::FixedBigInteger(std::string_view source) {
+  source.remove_prefix(std::min(source.find_first_not_of(" \t\n\v\f\r"), source.size()));
+  bool negative = !source.empty() && source[0] == '-';
+
+  if (!source.empty() && (source[0] == '-' || source[0] == '+')) {
+    source.remove_prefix(1);
   }
 
-  if (isZero()) {
-    *this = BigInteger();
-    sign_ = other > 0 ? Sign::Positive : Sign::Negative;
-    digits_.push_back(other);
-    digit_cnt_ = 1;
-    return *this;
+  if (source.empty()) {
+    throw std::invalid_argument("exception: BigInteger: invalid digit");
   }
 
-  Sign other_sign = other > 0 ? Sign::Positive : Sign::Negative;
+  while (!source.empty()) {
+    size_t width = std::min(source.size(), static_cast<size_t>(18));
+    limb_type scale = 1;
+    limb_type carry = 0;
+
+    for (size_t index = 0; index < width; ++index) {
+      limb_type digit = static_cast<limb_type>(static_cast<unsigned char>(source[index])) - '0';
+
+      if (digit > 9) {
+        throw std::invalid_argument("exception: BigInteger: invalid digit");
+      }
+
+      scale *= 10;
+      carry = carry * 10 + digit;
+    }
+
+    for (size_t index = 0; index < limb_cnt; ++index) {
+      wide_type product = static_cast<wide_type>(limbs_[index]) * scale + carry;
+      limbs_[index] = static_cast<limb_type>(product);
+      carry = static_cast<limb_type>(product >> 64);
+    }
+
+    if (carry != 0) {
+      throw std::invalid_argument("exception: FixedBigInteger: value out of range");
+    }
+
+    source.remove_prefix(width);
+  }
+
+  if (isNegative() && !(negative && *this == -*this)) {
+    throw std::invalid_argument("exception: FixedBigInteger: value out of range");
+  }
+
+  if (negative) {
+    *this = -*this;
+  }
+}
+
+template <size_t Bits>
+template <size_t OtherBits>
+constexpr FixedBigInteger<Bits>::FixedBigInteger(const FixedBigInteger<OtherBits>& source) {
+  limbs_.fill(source.isNegative() ? ~static_cast<limb_type>(0) : 0);
+  std::copy(source.limbs_.begin(), source.limbs_.begin() + std::min(limb_cnt, source.limb_cnt), limbs_.begin());
+}
 
-  if (sign_ * other_sign == Sign::Positive) {
+template <size_t Bits>
+template <typename Limbs>
+FixedBigInteger<Bits>::FixedBigInteger(const BasicBigInteger<Limbs>& source) {
+  if constexpr (Limbs::radix == 10) {
 
-    digits_[0] += other;
-    updateDigitsSimple(0);
+    *this = FixedBigInteger(BasicBigInteger<BinaryLimbs>(source));
 
   } else {
 
-    if (digit_cnt_ == 1 && digits_[0] == other) {
-      *this = BigInteger();
-      return *this;
+    size_t per_limb = 64 / Limbs::base_power;
+
+    for (size_t index = 0; index < std::min(source.digit_cnt_, limb_cnt * per_limb); ++index) {
+      limbs_[index / per_limb] |= static_cast<limb_type>(source.digits_[index])
+                                  << (Limbs::base_power * (index % per_limb));
     }
 
-    digits_[0] -= other;
+    if (source.sign_ == Sign::Negative) {
+      *this = -*this;
+    }
+  }
+}
 
-    if (digits_[0] < 0) {
+template <size_t Bits>
+template <typename Limbs>
+FixedBigInteger<Bits>::operator BasicBigInteger<Limbs>() const {
+  FixedBigInteger magnitude = isNegative() ? -*this : *this;
+  std::array<unsigned int, 2 * limb_cnt> halves{};
 
-      if (digit_cnt_ == 1) {
+  for (size_t index = 0; index < limb_cnt; ++index) {
+    halves[2 * index] = static_cast<unsigned int>(magnitude.limbs_[index]);
+    halves[2 * index + 1] = static_cast<unsigned int>(magnitude.limbs_[index] >> 32);
+  }
 
-        inverse();
-        digits_[0] *= -1;
+  BasicBigInteger<BinaryLimbs> result;
+  result.fromLimbs(halves.data(), halves.size());
 
-      } else {
+  if (isNegative()) {
+    result.inverse();
+  }
 
-        updateDigitsBack(0);
-      }
+  if constexpr (std::is_same_v<Limbs, BinaryLimbs>) {
+    return result;
+  } else {
+    return BasicBigInteger<Limbs>(result);
+  }
+}
+
+template <size_t Bits>
+constexpr FixedBigInteger<Bits>::operator bool() const {
+  return usedLimbs() > 0;
+}
+
+template <size_t Bits>
+std::string FixedBigInteger<Bits>::toString() const {
+  const limb_type chunk_base = 10000000000000000000ull;
+  FixedBigInteger magnitude = isNegative() ? -*this : *this;
+  std::vector<limb_type> chunks;
+
+  do {
+    chunks.push_back(divideWord(magnitude, chunk_base));
+  } while (magnitude);
+
+  std::string result = isNegative() ? "-" : "";
+  result += std::to_string(chunks.back());
+
+  for (size_t index = chunks.size() - 1; index > 0; --index) {
+    std::string chunk = std::to_string(chunks[index - 1]);
+    result.append(19 - chunk.size(), '0');
+    result += chunk;
+  }
+
+  return result;
+}
+
+template <size_t Bits>
+constexpr FixedBigInteger<Bits> FixedBigInteger<Bits>::operator-() const {
+  FixedBigInteger result = ~*this;
+  ++result;
+  return result;
+}
+
+template <size_t Bits>
+constexpr FixedBigInteger<Bits> FixedBigInteger<Bits>::operator~() const {
+  FixedBigInteger result;
+
+  for (size_t index = 0; index < limb_cnt; ++index) {
+    result.limbs_[index] = ~limbs_[index];
+  }
+
+  return result;
+}
+
+template <size_t Bits>
+constexpr FixedBigInteger<Bits>& FixedBigInteger<Bits>::operator+=(const FixedBigInteger& other) {
+  limb_type carry = 0;
+
+  for (size_t index = 0; index < limb_cnt; ++index) {
+    wide_type sum = static_cast<wide_type>(limbs_[index]) + other.limbs_[index] + carry;
+    limbs_[index] = static_cast<limb_type>(sum);
+    carry = static_cast<limb_type>(sum >> 64);
+  }
+
+  return *this;
+}
+
+template <size_t Bits>
+constexpr FixedBigInteger<Bits>& FixedBigInteger<Bits>::operator-=(const FixedBigInteger& other) {
+  limb_type borrow = 0;
+
+  for (size_t index = 0; index < limb_cnt; ++index) {
+    limb_type value = limbs_[index];
+    limbs_[index] = value - other.limbs_[index] - borrow;
+    borrow = (value < other.limbs_[index] || value - other.limbs_[index] < borrow) ? 1 : 0;
+  }
+
+  return *this;
+}
+
+template <size_t Bits>
+constexpr FixedBigInteger<Bits>& FixedBigInteger<Bits>::operator*=(const FixedBigInteger& other) {
+  std::array<limb_type, limb_cnt> result{};
+
+  for (size_t first = 0; first < limb_cnt; ++first) {
+    if (limbs_[first] == 0) {
+      continue;
+    }
+
+    limb_type carry = 0;
+
+    for (size_t second = 0; first + second < limb_cnt; ++second) {
+      wide_type product = static_cast<wide_type>(limbs_[first]) * other.limbs_[second] +
+                          result[first + second] + carry;
+      result[first + second] = static_cast<limb_type>(product);
+      carry = static_cast<limb_type>(product >> 64);
     }
   }
 
+  limbs_ = result;
   return *this;
 }
 
-BigInteger BigInteger::operator++(int) {
-  BigInteger copy(*this);
-  *this += 1ll;
-  return copy;
+template <size_t Bits>
+constexpr FixedBigInteger<Bits>& FixedBigInteger<Bits>::operator/=(const FixedBigInteger& other) {
+  divideSigned(*this, other, false);
+  return *this;
 }
 
-BigInteger& BigInteger::operator++() {
-  *this += 1ll;
+template <size_t Bits>
+constexpr FixedBigInteger<Bits>& FixedBigInteger<Bits>::operator%=(const FixedBigInteger& other) {
+  divideSigned(*this, other, true);
   return *this;
 }
 
-BigInteger BigInteger::operator--(int) {
-  BigInteger copy(*this);
-  *this += -1ll;
-  return copy;
+template <size_t Bits>
+constexpr FixedBigInteger<Bits>& FixedBigInteger<Bits>::operator++() {
+  for (size_t index = 0; index < limb_cnt && ++limbs_[index] == 0; ++index) {
+  }
+
+  return *this;
+}
+
+template <size_t Bits>
+constexpr FixedBigInteger<Bits> FixedBigInteger<Bits>::operator++(int) {
+  FixedBigInteger result = *this;
+  ++*this;
+  return result;
+}
+
+template <size_t Bits>
+constexpr FixedBigInteger<Bits>& FixedBigInteger<Bits>::operator--() {
+  for (size_t index = 0; index < limb_cnt && limbs_[index]-- == 0; ++index) {
+  }
+
+  return *this;
+}
+
+template <size_t Bits>
+constexpr FixedBigInteger<Bits> FixedBigInteger<Bits>::operator--(int) {
+  FixedBigInteger result = *this;
+  --*this;
+  return result;
+}
+
+template <size_t Bits>
+constexpr FixedBigInteger<Bits>& FixedBigInteger<Bits>::operator<<=(size_t shift) {
+  size_t limb_shift = std::min(shift / 64, limb_cnt);
+  size_t bit_shift = shift % 64;
+
+  for (size_t index = limb_cnt; index > 0; --index) {
+    size_t target = index - 1;
+    limb_type value = target >= limb_shift ? limbs_[target - limb_shift] << bit_shift : 0;
+
+    if (bit_shift > 0 && target > limb_shift) {
+      value |= limbs_[target - limb_shift - 1] >> (64 - bit_shift);
+    }
+
+    limbs_[target] = value;
+  }
+
+  return *this;
+}
+
+template <size_t Bits>
+constexpr FixedBigInteger<Bits>& FixedBigInteger<Bits>::operator>>=(size_t shift) {
+  limb_type fill = isNegative() ? ~static_cast<limb_type>(0) : 0;
+  size_t limb_shift = std::min(shift / 64, limb_cnt);
+  size_t bit_shift = shift % 64;
+
+  for (size_t target = 0; target < limb_cnt; ++target) {
+    size_t source = target + limb_shift;
+    limb_type low = source < limb_cnt ? limbs_[source] : fill;
+    limb_type high = source + 1 < limb_cnt ? limbs_[source + 1] : fill;
+    limbs_[target] = bit_shift > 0 ? (low >> bit_shift) | (high << (64 - bit_shift)) : low;
+  }
+
+  return *this;
+}
+
+template <size_t Bits>
+constexpr FixedBigInteger<Bits>& FixedBigInteger<Bits>::operator&=(const FixedBigInteger& other) {
+  for (size_t index = 0; index < limb_cnt; ++index) {
+    limbs_[index] &= other.limbs_[index];
+  }
+
+  return *this;
+}
+
+template <size_t Bits>
+constexpr FixedBigInteger<Bits>& FixedBigInteger<Bits>::operator|=(const FixedBigInteger& other) {
+  for (size_t index = 0; index < limb_cnt; ++index) {
+    limbs_[index] |= other.limbs_[index];
+  }
+
+  return *this;
+}
+
+template <size_t Bits>
+constexpr FixedBigInteger<Bits>& FixedBigInteger<Bits>::operator^=(const FixedBigInteger& other) {
+  for (size_t index = 0; index < limb_cnt; ++index) {
+    limbs_[index] ^= other.limbs_[index];
+  }
+
+  return *this;
+}
+
+template <size_t Bits>
+std::ostream& operator<<(std::ostream& out, const FixedBigInteger<Bits>& source) {
+  out << source.toString();
+  return out;
+}
+
+template <size_t Bits>
+std::istream& operator>>(std::istream& in, FixedBigInteger<Bits>& target) {
+  std::string input;
+
+  if (in >> input) {
+    target = FixedBigInteger<Bits>(input);
+  }
+
+  return in;
+}
+
+namespace bigint::expr {
+
+template <typename Derived>
+class Expression {
+public:
+  const Derived& derived() const {
+    return static_cast<const Derived&>(*this);
+  }
+};
+
+template <typename Limbs>
+class Accumulator {
+private:
+  using integer_type = BasicBigInteger<Limbs>;
+
+  integer_type positive_;
+  integer_type negative_;
+
+  static void prepare(integer_type& target, size_t count) {
+    count = std::max(target.digit_cnt_, count) + 1;
+    target.digits_.resize(count, 0);
+    target.digit_cnt_ = count;
+    target.sign_ = Sign::Positive;
+  }
+
+public:
+  Accumulator(integer_type&& initial, size_t limb_bound) {
+    integer_type& target = initial.isNegative() ? negative_ : positive_;
+    target = std::move(initial);
+    target.digits_.reserve(limb_bound + 1);
+
+    if (target.isNegative()) {
+      target.sign_ = Sign::Positive;
+    }
+  }
+
+  void add(const integer_type& value, bool negate) {
+    if (value.isZero()) {
+      return;
+    }
+
+    integer_type& target = value.isNegative() != negate ? negative_ : positive_;
+    prepare(target, value.digit_cnt_);
+    integer_type::addLimbs(target.digits_.data(), target.digit_cnt_, value.digits_.data(), value.digit_cnt_);
+    target.removeLeadingZeros();
+  }
+
+  void addProduct(const integer_type& first, const integer_type& second, bool negate) {
+    Sign sign = integer_type::signProduct(first, second);
+
+    if (sign == Sign::Zero) {
+      return;
+    }
+
+    integer_type& target = (sign == Sign::Negative) != negate ? negative_ : positive_;
+    prepare(target, first.digit_cnt_ + second.digit_cnt_);
+    integer_type::addMultipliedLimbs(target.digits_.data(), target.digit_cnt_,
+                                     first.digits_.data(), first.digit_cnt_,
+                                     second.digits_.data(), second.digit_cnt_);
+    target.removeLeadingZeros();
+  }
+
+  integer_type result() {
+    if (negative_.isZero()) {
+      return std::move(positive_);
+    }
+
+    int comparison = integer_type::compareLimbs(positive_.digits_.data(), positive_.digit_cnt_,
+                                                negative_.digits_.data(), negative_.digit_cnt_);
+
+    if (comparison < 0) {
+      positive_.swap(negative_);
+    }
+
+    integer_type::subtractLimbs(positive_.digits_.data(), positive_.digit_cnt_,
+                                negative_.digits_.data(), negative_.digit_cnt_);
+    positive_.sign_ = comparison < 0 ? Sign::Negative : Sign::Positive;
+    positive_.removeLeadingZeros();
+    return std::move(positive_);
+  }
+};
+
+template <typename Limbs>
+class Term : public Expression<Term<Limbs>> {
+private:
+  const BasicBigInteger<Limbs>& value_;
+
+public:
+  using limbs_type = Limbs;
+
+  explicit Term(const BasicBigInteger<Limbs>& value): value_(value) {}
+
+  const BasicBigInteger<Limbs>& value() const {
+    return value_;
+  }
+
+  size_t limbBound() const {
+    return value_.getDigitCount();
+  }
+
+  bool aliases(const BasicBigInteger<Limbs>& target) const {
+    return &value_ == &target;
+  }
+
+  void accumulateInto(Accumulator<Limbs>& accumulator, bool negate) const {
+    accumulator.add(value_, negate);
+  }
+};
+
+template <typename Limbs>
+class Product : public Expression<Product<Limbs>> {
+private:
+  const BasicBigInteger<Limbs>& first_;
+  const BasicBigInteger<Limbs>& second_;
+
+public:
+  using limbs_type = Limbs;
+
+  Product(const BasicBigInteger<Limbs>& first, const BasicBigInteger<Limbs>& second)
+      : first_(first), second_(second) {}
+
+  size_t limbBound() const {
+    return first_.getDigitCount() + second_.getDigitCount();
+  }
+
+  bool aliases(const BasicBigInteger<Limbs>& target) const {
+    return &first_ == &target || &second_ == &target;
+  }
+
+  void accumulateInto(Accumulator<Limbs>& accumulator, bool negate) const {
+    accumulator.addProduct(first_, second_, negate);
+  }
+};
+
+template <typename Left, typename Right, bool Subtract>
+class Sum : public Expression<Sum<Left, Right, Subtract>> {
+private:
+  Left left_;
+  Right right_;
+
+public:
+  using limbs_type = typename Left::limbs_type;
+
+  Sum(const Left& left, const Right& right): left_(left), right_(right) {}
+
+  size_t limbBound() const {
+    return std::max(left_.limbBound(), right_.limbBound()) + 1;
+  }
+
+  bool aliases(const BasicBigInteger<limbs_type>& target) const {
+    return left_.aliases(target) || right_.aliases(target);
+  }
+
+  void accumulateInto(Accumulator<limbs_type>& accumulator, bool negate) const {
+    left_.accumulateInto(accumulator, negate);
+    right_.accumulateInto(accumulator, negate != Subtract);
+  }
+};
+
+template <typename Limbs>
+Term<Limbs> lazy(const BasicBigInteger<Limbs>& value) {
+  return Term<Limbs>(value);
+}
+
+template <typename Limbs>
+Product<Limbs> operator*(const Term<Limbs>& first, const Term<Limbs>& second) {
+  return Product<Limbs>(first.value(), second.value());
+}
+
+template <typename Limbs>
+Product<Limbs> operator*(const Term<Limbs>& first, const BasicBigInteger<Limbs>& second) {
+  return Product<Limbs>(first.value(), second);
+}
+
+template <typename Limbs>
+Product<Limbs> operator*(const BasicBigInteger<Limbs>& first, const Term<Limbs>& second) {
+  return Product<Limbs>(first, second.value());
+}
+
+template <typename Left, typename Right>
+Sum<Left, Right, false> operator+(const Expression<Left>& left, const Expression<Right>& right) {
+  return Sum<Left, Right, false>(left.derived(), right.derived());
+}
+
+template <typename Left, typename Limbs>
+Sum<Left, Term<Limbs>, false> operator+(const Expression<Left>& left, const BasicBigInteger<Limbs>& right) {
+  return Sum<Left, Term<Limbs>, false>(left.derived(), Term<Limbs>(right));
+}
+
+template <typename Limbs, typename Right>
+Sum<Term<Limbs>, Right, false> operator+(const BasicBigInteger<Limbs>& left, const Expression<Right>& right) {
+  return Sum<Term<Limbs>, Right, false>(Term<Limbs>(left), right.derived());
+}
+
+template <typename Left, typename Right>
+Sum<Left, Right, true> operator-(const Expression<Left>& left, const Expression<Right>& right) {
+  return Sum<Left, Right, true>(left.derived(), right.derived());
+}
+
+template <typename Left, typename Limbs>
+Sum<Left, Term<Limbs>, true> operator-(const Expression<Left>& left, const BasicBigInteger<Limbs>& right) {
+  return Sum<Left, Term<Limbs>, true>(left.derived(), Term<Limbs>(right));
+}
+
+template <typename Limbs, typename Right>
+Sum<Term<Limbs>, Right, true> operator-(const BasicBigInteger<Limbs>& left, const Expression<Right>& right) {
+  return Sum<Term<Limbs>, Right, true>(Term<Limbs>(left), right.derived());
+}
+
+}
+
+template <typename Limbs>
+template <typename Derived>
+void BasicBigInteger<Limbs>::accumulateExpression(const Derived& expression, bool negate) {
+  if (expression.aliases(*this)) {
+    BasicBigInteger value(expression);
+
+    if (negate) {
+      *this -= value;
+    } else {
+      *this += value;
+    }
+
+    return;
+  }
+
+  bigint::expr::Accumulator<Limbs> accumulator(std::move(*this), expression.limbBound());
+  expression.accumulateInto(accumulator, negate);
+  *this = accumulator.result();
+}
+
+template <typename Limbs>
+template <typename Derived>
+BasicBigInteger<Limbs>::BasicBigInteger(const bigint::expr::Expression<Derived>& source) {
+  accumulateExpression(source.derived(), false);
+}
+
+template <typename Limbs>
+template <typename Derived>
+BasicBigInteger<Limbs>& BasicBigInteger<Limbs>::operator=(const bigint::expr::Expression<Derived>& source) {
+  if (source.derived().aliases(*this)) {
+    *this = BasicBigInteger(source);
+    return *this;
+  }
+
+  sign_ = Sign::Zero;
+  digit_cnt_ = 0;
+  digits_.clear();
+  accumulateExpression(source.derived(), false);
+  return *this;
+}
+
+template <typename Limbs>
+template <typename Derived>
+BasicBigInteger<Limbs>& BasicBigInteger<Limbs>::operator+=(const bigint::expr::Expression<Derived>& source) {
+  accumulateExpression(source.derived(), false);
+  return *this;
 }
 
-BigInteger& BigInteger::operator--() {
-  *this += -1ll;
+template <typename Limbs>
+template <typename Derived>
+BasicBigInteger<Limbs>& BasicBigInteger<Limbs>::operator-=(const bigint::expr::Expression<Derived>& source) {
+  accumulateExpression(source.derived(), true);
   return *this;
 }
 
-BigInteger& BigInteger::operator-=(const BigInteger& other) {
-  if (this == &other) {
-    *this = BigInteger();
-    return *this;
-  }
+template <typename Limbs>
+class BasicModulus {
+private:
+  using integer_type = BasicBigInteger<Limbs>;
+  using limb_type = typename Limbs::limb_type;
+  using wide_type = unsigned long long;
 
-  inverse();
-  *this += other;
-  inverse();
+  static const long long base = Limbs::base;
 
-  return *this;
-}
+  integer_type modulus_;
+  size_t limb_cnt_ = 0;
+  bool montgomery_ = false;
+  limb_type inverse_limb_ = 0;
+  std::vector<limb_type> r_squared_;
+  std::vector<limb_type> one_;
+  std::vector<limb_type> modulus_limbs_;
+  std::vector<limb_type> reciprocal_;
 
-BigInteger& BigInteger::operator*=(const BigInteger& other) {
-  BigInteger result;
+  void toLimbs(const integer_type& value, limb_type* result) const;
 
-  if (sign_ * other.sign_ == Sign::Zero) {
-    swap(result);
-    return *this;
-  }
+  integer_type fromLimbs(const limb_type* limbs) const;
 
-  result.sign_ = sign_ * other.sign_;
-  result.digit_cnt_ = digit_cnt_ + other.digit_cnt_ - 1;
-  result.digits_ = std::vector<long long>(result.digit_cnt_, 0);
+  size_t scratchSize() const;
 
-  for (size_t index_oth = 0; index_oth < other.digit_cnt_; ++index_oth) {
+  void multiplyMontgomery(const limb_type* first, const limb_type* second,
+                          limb_type* result, limb_type* scratch) const;
 
-    for (size_t index = 0; index < digit_cnt_; ++index) {
-      result.digits_[index + index_oth] += digits_[index] * other.digits_[index_oth];
-    }
+  void multiplyBarrett(const limb_type* first, const limb_type* second,
+                       limb_type* result, limb_type* scratch) const;
 
-    result.updateDigits(index_oth);
-  }
+  void multiplyLimbs(const limb_type* first, const limb_type* second,
+                     limb_type* result, limb_type* scratch) const;
 
-  swap(result);
-  return *this;
-}
+  void enterForm(const integer_type& value, limb_type* result, limb_type* scratch) const;
 
-BigInteger& BigInteger::operator*=(long long other) {
-  if (sign_ == Sign::Zero || other == 0LL) {
+  integer_type leaveForm(const limb_type* limbs, limb_type* scratch) const;
 
-    *this = BigInteger();
-    return *this;
-  }
+public:
+  explicit BasicModulus(const integer_type& modulus);
 
-  for (size_t index = 0; index < digit_cnt_; ++index) {
-    digits_[index] *= other;
-  }
+  const integer_type& getModulus() const;
 
-  updateDigits(0);
-  return *this;
-}
+  integer_type reduce(const integer_type& value) const;
 
-BigInteger& BigInteger::operator<<(size_t value) {
-  if (isZero()) {
-    return *this;
-  }
+  integer_type mulmod(const integer_type& first, const integer_type& second) const;
 
-  std::vector<long long> new_digits_(value, 0ll);
-  digits_.insert(digits_.begin(), new_digits_.begin(), new_digits_.end());
-  digit_cnt_ += value;
-  return *this;
-}
+  integer_type powmod(const integer_type& value, const integer_type& exponent) const;
 
-BigInteger& BigInteger::operator/=(const BigInteger& other) {
-  if (other.sign_ * sign_ == Sign::Zero) {
-    *this = BigInteger();
+  integer_type invmod(const integer_type& value) const;
+};
 
-    if (other.isZero()) {
-      std::cerr << "Error: division by zero!\n";
-    }
+using Modulus = BasicModulus<DecimalLimbs>;
 
-    return *this;
+using BinaryModulus = BasicModulus<BinaryLimbs>;
+
+template <typename Limbs>
+BasicModulus<Limbs>::BasicModulus(const integer_type& modulus): modulus_(modulus) {
+  if (!modulus_.isPositive()) {
+    std::cerr << "Error: modulus must be positive!\n";
+    modulus_ = integer_type(1);
   }
 
-  if (sign_ * other.sign_ == Sign::Positive) {
+  limb_cnt_ = modulus_.digit_cnt_;
+  long long low_limb = static_cast<long long>(modulus_.digits_[0]);
+  long long old_remainder = low_limb;
+  long long remainder = base;
+  long long old_coefficient = 1;
+  long long coefficient = 0;
+
+  while (remainder != 0) {
+    long long quotient = old_remainder / remainder;
+    old_remainder -= quotient * remainder;
+    std::swap(old_remainder, remainder);
+    old_coefficient -= quotient * coefficient;
+    std::swap(old_coefficient, coefficient);
+  }
 
-    if (*this == other) {
-      *this = BigInteger(1);
-      return *this;
-    }
+  montgomery_ = old_remainder == 1;
 
-    if ((*this < other) ^ (sign_ == Sign::Negative)) {
-      *this = BigInteger();
-      return *this;
+  if (montgomery_) {
+    old_coefficient %= base;
+
+    if (old_coefficient < 0) {
+      old_coefficient += base;
     }
 
-    BigInteger divisor(other);
+    inverse_limb_ = static_cast<limb_type>((base - old_coefficient) % base);
 
-    if (sign_ == Sign::Negative) {
-      inverse();
-      divisor.inverse();
-    }
+    integer_type r_squared(1);
+    r_squared.shiftLimbs(2 * limb_cnt_);
+    r_squared %= modulus_;
+    r_squared_.resize(limb_cnt_);
+    toLimbs(r_squared, r_squared_.data());
 
-    divisionPositive(*this, divisor);
-    return *this;
+    std::vector<limb_type> scratch(scratchSize());
+    one_.resize(limb_cnt_);
+    enterForm(integer_type(1), one_.data(), scratch.data());
+
+  } else {
+
+    integer_type reciprocal(1);
+    reciprocal.shiftLimbs(2 * limb_cnt_);
+    reciprocal /= modulus_;
+    modulus_limbs_.assign(limb_cnt_ + 2, 0);
+    reciprocal_.assign(limb_cnt_ + 2, 0);
+    std::copy(modulus_.digits_.data(), modulus_.digits_.data() + limb_cnt_, modulus_limbs_.data());
+    std::copy(reciprocal.digits_.data(), reciprocal.digits_.data() + reciprocal.digit_cnt_, reciprocal_.data());
+    one_.assign(limb_cnt_, 0);
+    toLimbs(integer_type(1), one_.data());
   }
+}
 
-  inverse();
-  *this /= other;
-  inverse();
+template <typename Limbs>
+void BasicModulus<Limbs>::toLimbs(const integer_type& value, limb_type* result) const {
+  std::fill(result, result + limb_cnt_, 0);
+  std::copy(value.digits_.data(), value.digits_.data() + value.digit_cnt_, result);
+}
 
-  return *this;
+template <typename Limbs>
+typename BasicModulus<Limbs>::integer_type BasicModulus<Limbs>::fromLimbs(const limb_type* limbs) const {
+  integer_type result;
+  result.fromLimbs(limbs, limb_cnt_);
+  return result;
 }
 
-BigInteger& BigInteger::operator%=(const BigInteger& other) {
-  if (isZero()) {
-    return *this;
-  }
+template <typename Limbs>
+size_t BasicModulus<Limbs>::scratchSize() const {
+  return 6 * limb_cnt_ + 9 + integer_type::karatsubaBufferSize(limb_cnt_ + 2);
+}
 
-  bool isNeg = isNegative();
-  BigInteger divisor(other);
+template <typename Limbs>
+void BasicModulus<Limbs>::multiplyMontgomery(const limb_type* first, const limb_type* second,
+                                             limb_type* result, limb_type* scratch) const {
+  const limb_type* modulus = modulus_.digits_.data();
+  limb_type* product = scratch;
+  limb_type* buffer = scratch + 2 * limb_cnt_ + 1;
 
-  if (other.isNegative()) {
-    divisor.inverse();
+  if (first == second) {
+    integer_type::squareKaratsuba(first, limb_cnt_, product, buffer);
+  } else {
+    integer_type::multiplyKaratsuba(first, second, limb_cnt_, product, buffer);
   }
 
-  if (isNeg) {
-    inverse();
-  }
+  product[2 * limb_cnt_] = 0;
 
-  if (*this >= other) {
-    *this = divisionPositive(*this, divisor);
+  for (size_t index_sec = 0; index_sec < limb_cnt_; ++index_sec) {
+    wide_type factor = static_cast<wide_type>(product[index_sec]) * inverse_limb_ % base;
+    wide_type carry = 0;
+    size_t index = index_sec;
+
+    for (size_t index_mod = 0; index_mod < limb_cnt_; ++index_mod, ++index) {
+      wide_type current = factor * modulus[index_mod] + product[index] + carry;
+      carry = current / base;
+      product[index] = static_cast<limb_type>(current % base);
+    }
+
+    for (; carry != 0; ++index) {
+      wide_type current = static_cast<wide_type>(product[index]) + carry;
+      carry = current / base;
+      product[index] = static_cast<limb_type>(current % base);
+    }
   }
 
-  if (isNeg) {
-    inverse();
+  limb_type* reduced = product + limb_cnt_;
+
+  if (reduced[limb_cnt_] != 0 ||
+      integer_type::compareLimbs(reduced, limb_cnt_, modulus, limb_cnt_) >= 0) {
+    integer_type::subtractLimbs(reduced, limb_cnt_ + 1, modulus, limb_cnt_);
   }
 
-  return *this;
+  std::copy(reduced, reduced + limb_cnt_, result);
 }
 
-std::ostream& operator<<(std::ostream& out, const BigInteger& source) {
-  out << source.toString();
-  return out;
-}
+template <typename Limbs>
+void BasicModulus<Limbs>::multiplyBarrett(const limb_type* first, const limb_type* second,
+                                          limb_type* result, limb_type* scratch) const {
+  limb_type* product = scratch;
+  limb_type* buffer = scratch + 2 * limb_cnt_ + 1;
 
-std::istream& operator>>(std::istream& in, BigInteger& target) {
-  std::string input;
-  in >> input;
-  target = BigInteger(input);
-  return in;
-}
+  if (first == second) {
+    integer_type::squareKaratsuba(first, limb_cnt_, product, buffer);
+  } else {
+    integer_type::multiplyKaratsuba(first, second, limb_cnt_, product, buffer);
+  }
 
-bool operator<(const BigInteger& that, const BigInteger& other) {
-  if (BigInteger::signProduct(that, other) == Sign::Negative) {
-    return that.isNegative();
+  if (limb_cnt_ == 1) {
+    result[0] = integer_type::divideLimbsShort(product, 2, modulus_.digits_[0], nullptr);
+    return;
   }
 
-  size_t digit_cnt_that = that.getDigitCount();
-  size_t digit_cnt_other = other.getDigitCount();
+  const limb_type* modulus = modulus_limbs_.data();
+  limb_type* estimate = buffer;
+  limb_type* back = estimate + 2 * limb_cnt_ + 4;
+  limb_type* estimate_buffer = back + 2 * limb_cnt_ + 4;
+
+  product[2 * limb_cnt_] = 0;
+  integer_type::multiplyKaratsuba(product + limb_cnt_ - 1, reciprocal_.data(), limb_cnt_ + 2,
+                                  estimate, estimate_buffer);
+  integer_type::multiplyKaratsuba(estimate + limb_cnt_ + 1, modulus, limb_cnt_ + 2, back, estimate_buffer);
+
+  wide_type borrow = 0;
 
-  if (digit_cnt_that < digit_cnt_other) {
-    return !(that.isNegative());
+  for (size_t index = 0; index <= limb_cnt_; ++index) {
+    wide_type current = static_cast<wide_type>(product[index]) + base - back[index] - borrow;
+    borrow = current < base ? 1 : 0;
+    product[index] = static_cast<limb_type>(current - (1 - borrow) * base);
   }
 
-  if (BigInteger::signProduct(that, other) == Sign::Zero) {
-    return that.isZero();
+  while (integer_type::compareLimbs(product, limb_cnt_ + 1, modulus, limb_cnt_ + 1) >= 0) {
+    integer_type::subtractLimbs(product, limb_cnt_ + 1, modulus, limb_cnt_);
   }
 
-  if (digit_cnt_that > digit_cnt_other) {
-    return that.isNegative();
+  std::copy(product, product + limb_cnt_, result);
+}
+
+template <typename Limbs>
+void BasicModulus<Limbs>::multiplyLimbs(const limb_type* first, const limb_type* second,
+                                        limb_type* result, limb_type* scratch) const {
+  if (montgomery_) {
+    multiplyMontgomery(first, second, result, scratch);
+  } else {
+    multiplyBarrett(first, second, result, scratch);
   }
+}
 
-  size_t index = digit_cnt_that - 1;
-  const std::vector<long long>& digits_that = that.getDigits();
-  const std::vector<long long>& digits_other = other.getDigits();
+template <typename Limbs>
+void BasicModulus<Limbs>::enterForm(const integer_type& value, limb_type* result, limb_type* scratch) const {
+  toLimbs(reduce(value), result);
 
-  while (digits_that[index] == digits_other[index]) {
-    if (index == 0) {
-      break;
-    }
-    --index;
+  if (montgomery_) {
+    multiplyMontgomery(result, r_squared_.data(), result, scratch);
   }
+}
 
-  if (digits_that[index] == digits_other[index]) {
-    return false;
+template <typename Limbs>
+typename BasicModulus<Limbs>::integer_type BasicModulus<Limbs>::leaveForm(const limb_type* limbs,
+                                                                          limb_type* scratch) const {
+  if (!montgomery_) {
+    return fromLimbs(limbs);
   }
 
-  return (that.isNegative()) ^ (digits_that[index] < digits_other[index]);
+  limb_type* unit = scratch;
+  limb_type* result = scratch + limb_cnt_;
+  std::fill(unit, unit + limb_cnt_, 0);
+  unit[0] = 1;
+  multiplyMontgomery(limbs, unit, result, scratch + 2 * limb_cnt_);
+  return fromLimbs(result);
 }
 
-bool operator>(const BigInteger& that, const BigInteger& other) {
-  return other < that;
+template <typename Limbs>
+const typename BasicModulus<Limbs>::integer_type& BasicModulus<Limbs>::getModulus() const {
+  return modulus_;
 }
 
-bool operator>=(const BigInteger& that, const BigInteger& other) {
-  return !(that < other);
-}
+template <typename Limbs>
+typename BasicModulus<Limbs>::integer_type BasicModulus<Limbs>::reduce(const integer_type& value) const {
+  if (value.digit_cnt_ < limb_cnt_ && value.isPositive()) {
+    return value;
+  }
 
-bool operator<=(const BigInteger& that, const BigInteger& other) {
-  return !(that > other);
-}
+  integer_type result(value);
+  result %= modulus_;
 
-bool operator==(const BigInteger& that, const BigInteger& other) {
-  if (BigInteger::signProduct(that, other) == Sign::Negative) {
-    return false;
+  if (result.isNegative()) {
+    result += modulus_;
   }
 
-  if (BigInteger::signProduct(that, other) == Sign::Zero) {
+  return result;
+}
 
-    return that.isZero() && other.isZero();
+template <typename Limbs>
+typename BasicModulus<Limbs>::integer_type BasicModulus<Limbs>::mulmod(const integer_type& first,
+                                                                       const integer_type& second) const {
+  std::vector<limb_type> buffer(2 * limb_cnt_ + scratchSize());
+  limb_type* first_limbs = buffer.data();
+  limb_type* second_limbs = first_limbs + limb_cnt_;
+  limb_type* scratch = second_limbs + limb_cnt_;
+
+  if (montgomery_) {
+    enterForm(first, first_limbs, scratch);
+    toLimbs(reduce(second), second_limbs);
+  } else {
+    toLimbs(reduce(first), first_limbs);
+    toLimbs(reduce(second), second_limbs);
   }
 
-  size_t digit_cnt_that = that.getDigitCount();
+  multiplyLimbs(first_limbs, second_limbs, first_limbs, scratch);
+  return fromLimbs(first_limbs);
+}
 
-  if (digit_cnt_that != other.getDigitCount()) {
-    return false;
+template <typename Limbs>
+typename BasicModulus<Limbs>::integer_type BasicModulus<Limbs>::powmod(const integer_type& value,
+                                                                       const integer_type& exponent) const {
+  if (exponent.isNegative()) {
+    return powmod(invmod(value), -exponent);
   }
 
-  size_t index = digit_cnt_that - 1;
-  const std::vector<long long>& digits_that = that.getDigits();
-  const std::vector<long long>& digits_other = other.getDigits();
+  BasicBigInteger<BinaryLimbs> exponent_bits(exponent);
+  std::span<const unsigned int> words = exponent_bits.getDigits();
+  size_t bit_cnt = words.empty() ? 0 : 32 * words.size() - std::countl_zero(words.back());
+  size_t window = bit_cnt > 671 ? 6 : bit_cnt > 239 ? 5 : bit_cnt > 79 ? 4 : bit_cnt > 23 ? 3 : 1;
 
-  while (digits_that[index] == digits_other[index]) {
-    if (index == 0) {
-      return true;
-    }
+  auto bit = [&words](size_t index) {
+    return (words[index / 32] >> (index % 32)) & 1;
+  };
 
-    --index;
-  }
+  std::vector<limb_type> scratch(scratchSize());
+  std::vector<limb_type> table(limb_cnt_ << (window - 1));
+  std::vector<limb_type> square(limb_cnt_);
+  std::vector<limb_type> result(one_);
 
-  return false;
-}
+  enterForm(value, table.data(), scratch.data());
+  multiplyLimbs(table.data(), table.data(), square.data(), scratch.data());
 
-bool operator!=(const BigInteger& that, const BigInteger& other) {
-  return !(that == other);
-}
+  for (size_t index = 1; index < (static_cast<size_t>(1) << (window - 1)); ++index) {
+    multiplyLimbs(table.data() + (index - 1) * limb_cnt_, square.data(),
+                  table.data() + index * limb_cnt_, scratch.data());
+  }
 
-BigInteger operator+(const BigInteger& bi_first, const BigInteger& bi_second) {
-  BigInteger result(bi_first);
-  result += bi_second;
-  return result;
-}
+  for (size_t end = bit_cnt; end > 0;) {
+    if (bit(end - 1) == 0) {
+      multiplyLimbs(result.data(), result.data(), result.data(), scratch.data());
+      --end;
+      continue;
+    }
 
-BigInteger operator+(int int_first, const BigInteger& bi_second) {
-  BigInteger result(bi_second);
-  result += static_cast<long long>(int_first);
-  return result;
-}
+    size_t begin = end > window ? end - window : 0;
 
-BigInteger operator+(const BigInteger& bi_first, int int_second) {
-  BigInteger result(bi_first);
-  result += static_cast<long long>(int_second);
-  return result;
-}
+    while (bit(begin) == 0) {
+      ++begin;
+    }
 
-BigInteger operator-(const BigInteger& bi_first, const BigInteger& bi_second) {
-  BigInteger result(bi_first);
-  result -= bi_second;
-  return result;
-}
+    size_t digit = 0;
 
-BigInteger operator-(int int_first, const BigInteger& bi_second) {
-  BigInteger result(bi_second);
-  result -= static_cast<long long>(int_first);
-  result.inverse();
-  return result;
-}
+    for (size_t index = end; index > begin; --index) {
+      multiplyLimbs(result.data(), result.data(), result.data(), scratch.data());
+      digit = 2 * digit + bit(index - 1);
+    }
 
-BigInteger operator-(const BigInteger& bi_first, int int_second) {
-  BigInteger result(bi_first);
-  result -= static_cast<long long>(int_second);
-  return result;
-}
+    multiplyLimbs(result.data(), table.data() + (digit / 2) * limb_cnt_, result.data(), scratch.data());
+    end = begin;
+  }
 
-BigInteger operator*(const BigInteger& bi_first, const BigInteger& bi_second) {
-  BigInteger result(bi_first);
-  result *= bi_second;
-  return result;
+  return leaveForm(result.data(), scratch.data());
 }
 
-BigInteger operator/(const BigInteger& bi_first, const BigInteger& bi_second) {
-  BigInteger result(bi_first);
-  result /= bi_second;
-  return result;
-}
+template <typename Limbs>
+typename BasicModulus<Limbs>::integer_type BasicModulus<Limbs>::invmod(const integer_type& value) const {
+  integer_type old_remainder(reduce(value));
+  integer_type remainder(modulus_);
+  integer_type old_coefficient(1);
+  integer_type coefficient(0);
+
+  while (!remainder.isZero()) {
+    integer_type quotient(old_remainder / remainder);
+    old_remainder -= quotient * remainder;
+    old_remainder.swap(remainder);
+    old_coefficient -= quotient * coefficient;
+    old_coefficient.swap(coefficient);
+  }
 
-BigInteger operator%(const BigInteger& bi_first, const BigInteger& bi_second) {
-  BigInteger result(bi_first);
-  result %= bi_second;
-  return result;
-}
+  if (old_remainder != integer_type(1)) {
+    std::cerr << "Error: value is not invertible modulo the modulus!\n";
+    return integer_type();
+  }
 
-BigInteger operator""_bi(const char* source) {
-  std::string temp_input(source);
-  BigInteger result(temp_input);
-  return result;
+  return reduce(old_coefficient);
 }
 
 class Rational;
@@ -978,6 +5935,8 @@ private:
   Sign sign_;
   BigInteger numerator_;
   BigInteger denominator_;
+  bool reduced_ = true;
+  size_t reduced_limbs_ = 0;
 
   void toSimpleFraction() {
     if (numerator_.isZero()) {
@@ -987,13 +5946,73 @@ private:
 
     BigInteger gcd(BigInteger::gcd(numerator_, denominator_));
 
-    if (gcd != BigInteger(1)) {
+    if (gcd != 1) {
       numerator_ /= gcd;
       denominator_ /= gcd;
     }
   }
 
+  void normalize() {
+    if (reduced_) {
+      return;
+    }
+
+    toSimpleFraction();
+    reduced_ = true;
+    reduced_limbs_ = numerator_.getDigitCount() + denominator_.getDigitCount();
+  }
+
+  void normalizeIfGrown() {
+    if (numerator_.getDigitCount() + denominator_.getDigitCount() > 2 * reduced_limbs_ + normalization_threshold) {
+      normalize();
+    }
+  }
+
+  Rational reduced() const {
+    Rational result(*this);
+    result.normalize();
+    return result;
+  }
+
+  BigInteger signedNumerator() const {
+    BigInteger result(numerator_);
+
+    if (sign_ == Sign::Negative) {
+      result.inverse();
+    }
+
+    return result;
+  }
+
+  void setFraction(BigInteger numerator, BigInteger denominator, bool reduced) {
+    if (numerator.isZero()) {
+      *this = Rational();
+      return;
+    }
+
+    sign_ = numerator.isNegative() ? Sign::Negative : Sign::Positive;
+
+    if (numerator.isNegative()) {
+      numerator.inverse();
+    }
+
+    numerator_ = std::move(numerator);
+    denominator_ = std::move(denominator);
+    reduced_ = reduced;
+
+    if (reduced) {
+      reduced_limbs_ = numerator_.getDigitCount() + denominator_.getDigitCount();
+    }
+  }
+
 public:
+  inline static bool lazy_normalization = false;
+  inline static size_t normalization_threshold = 16;
+
+  friend bool operator==(const Rational& that, const Rational& other);
+
+  friend bool operator<(const Rational& that, const Rational& other);
+
   static Sign signProduct(const Rational& that, const Rational& other) {
     return that.sign_ * other.sign_;
   }
@@ -1004,6 +6023,8 @@ public:
 
   Rational(const Rational& source) = default;
 
+  Rational(Rational&& source) = default;
+
   Rational(int source): sign_(Sign::Zero), numerator_(BigInteger(source)),
                               denominator_(BigInteger(1)) {
     if (source < 0) {
@@ -1031,6 +6052,8 @@ public:
 
   Rational& operator=(const Rational& other) = default;
 
+  Rational& operator=(Rational&& other) = default;
+
   bool isZero() const {
     return sign_ == Sign::Zero;
   }
@@ -1054,18 +6077,27 @@ public:
     }
   }
 
-  const BigInteger& getNumerator() const {
-    return numerator_;
+  BigInteger getNumerator() const {
+    return reduced_ ? numerator_ : reduced().numerator_;
   }
 
-  const BigInteger& getDenominator() const {
-    return denominator_;
+  BigInteger getDenominator() const {
+    return reduced_ ? denominator_ : reduced().denominator_;
   }
 
   Sign getSign() const {
     return sign_;
   }
 
+  size_t hash() const {
+    if (!reduced_) {
+      return reduced().hash();
+    }
+
+    return bigint::hashing::mix(numerator_.hash() ^ bigint::hashing::secret[static_cast<size_t>(sign_)],
+                                denominator_.hash() ^ bigint::hashing::secret[3]);
+  }
+
   Rational operator-() const {
     Rational new_r(*this);
     new_r.inverse();
@@ -1080,13 +6112,17 @@ public:
       return result;
     }
 
+    if (!reduced_) {
+      return reduced().toString();
+    }
+
     if (sign_ == Sign::Negative) {
       result += '-';
     }
 
     result += numerator_.toString();
 
-    if (denominator_ != BigInteger(1)) {
+    if (denominator_ != 1) {
       result += '/';
       result += denominator_.toString();
     }
@@ -1121,7 +6157,7 @@ public:
     size_t diff_size = numerator_temp.makeGreaterThan(denominator_);
     size_t shift_size = (precision + BigInteger::base_power) / BigInteger::base_power;
 
-    numerator_temp << shift_size;
+    numerator_temp.shiftLimbs(shift_size);
     BigInteger::divisionPositive(numerator_temp, denominator_);
     std::string str_temp;
 
@@ -1152,34 +6188,42 @@ public:
       return *this;
     }
 
-    if (sign_ * other.sign_ == Sign::Positive) {
-      numerator_ *= other.denominator_;
-      numerator_ += denominator_ * other.numerator_;
-      denominator_ *= other.denominator_;
-      toSimpleFraction();
+    if (lazy_normalization) {
+      if (denominator_ == other.denominator_) {
+        setFraction(signedNumerator() + other.signedNumerator(), denominator_, false);
+      } else {
+        setFraction(signedNumerator() * other.denominator_ + other.signedNumerator() * denominator_,
+                    denominator_ * other.denominator_, false);
+      }
+
+      normalizeIfGrown();
       return *this;
     }
 
-    inverse();
+    normalize();
 
-    if (*this == other) {
+    BigInteger gcd(BigInteger::gcd(denominator_, other.denominator_));
+    BigInteger other_scale(other.denominator_ / gcd);
+    BigInteger numerator(signedNumerator() * other_scale + other.signedNumerator() * (denominator_ / gcd));
+
+    if (numerator.isZero()) {
       *this = Rational();
       return *this;
     }
 
-    numerator_ = (-numerator_) * other.denominator_ + denominator_ * other.numerator_;
-    denominator_ *= other.denominator_;
-
-    if (numerator_.isNegative()) {
-      numerator_.inverse();
-      inverse();
-    }
-
-    toSimpleFraction();
+    BigInteger reduction(BigInteger::gcd(numerator.isNegative() ? -numerator : numerator, gcd));
+    numerator /= reduction;
+    setFraction(std::move(numerator), denominator_ / reduction * other_scale, other.reduced_);
+    normalize();
     return *this;
   }
 
   Rational& operator-=(const Rational& other) {
+    if (this == &other) {
+      *this = Rational();
+      return *this;
+    }
+
     inverse();
     *this += other;
     inverse();
@@ -1192,11 +6236,27 @@ public:
       return *this;
     }
 
-    sign_ = sign_ * other.sign_;
-    numerator_ *= other.numerator_;
-    denominator_ *= other.denominator_;
-    toSimpleFraction();
+    Sign sign = sign_ * other.sign_;
 
+    if (lazy_normalization) {
+      numerator_ *= other.numerator_;
+      denominator_ *= other.denominator_;
+      sign_ = sign;
+      reduced_ = false;
+      normalizeIfGrown();
+      return *this;
+    }
+
+    normalize();
+
+    BigInteger first_gcd(BigInteger::gcd(numerator_, other.denominator_));
+    BigInteger second_gcd(BigInteger::gcd(other.numerator_, denominator_));
+    BigInteger numerator(numerator_ / first_gcd * (other.numerator_ / second_gcd));
+    BigInteger denominator(denominator_ / second_gcd * (other.denominator_ / first_gcd));
+
+    setFraction(std::move(numerator), std::move(denominator), other.reduced_);
+    sign_ = sign;
+    normalize();
     return *this;
   }
 
@@ -1211,11 +6271,28 @@ public:
       return *this;
     }
 
-    sign_ = sign_ * other.sign_;
-    numerator_ *= other.denominator_;
-    denominator_ *= other.numerator_;
-    toSimpleFraction();
+    Sign sign = sign_ * other.sign_;
+
+    if (lazy_normalization) {
+      BigInteger numerator(numerator_ * other.denominator_);
+      BigInteger denominator(denominator_ * other.numerator_);
 
+      setFraction(std::move(numerator), std::move(denominator), false);
+      sign_ = sign;
+      normalizeIfGrown();
+      return *this;
+    }
+
+    normalize();
+
+    BigInteger first_gcd(BigInteger::gcd(numerator_, other.numerator_));
+    BigInteger second_gcd(BigInteger::gcd(denominator_, other.denominator_));
+    BigInteger numerator(numerator_ / first_gcd * (other.denominator_ / second_gcd));
+    BigInteger denominator(denominator_ / second_gcd * (other.numerator_ / first_gcd));
+
+    setFraction(std::move(numerator), std::move(denominator), other.reduced_);
+    sign_ = sign;
+    normalize();
     return *this;
   }
 
@@ -1227,8 +6304,15 @@ public:
 };
 
 bool operator==(const Rational& that, const Rational& other) {
-  return ((that.getSign() == other.getSign()) && (that.getNumerator() == other.getNumerator())
-                                              && (that.getDenominator() == other.getDenominator()));
+  if (that.sign_ != other.sign_) {
+    return false;
+  }
+
+  if (that.reduced_ && other.reduced_) {
+    return that.numerator_ == other.numerator_ && that.denominator_ == other.denominator_;
+  }
+
+  return that.numerator_ * other.denominator_ == other.numerator_ * that.denominator_;
 }
 
 bool operator<(const Rational& that, const Rational& other) {
@@ -1244,7 +6328,7 @@ bool operator<(const Rational& that, const Rational& other) {
     return false;
   }
 
-  return (that.isNegative()) ^ ((that.getNumerator() * other.getDenominator()) < (other.getNumerator() * that.getDenominator()));
+  return (that.isNegative()) ^ ((that.numerator_ * other.denominator_) < (other.numerator_ * that.denominator_));
 }
 
 bool operator>(const Rational& that, const Rational& other) {
@@ -1286,3 +6370,71 @@ Rational operator/(const Rational& first, const Rational& second) {
   result /= second;
   return result;
 }
+
+Rational sqrt(const Rational& value, size_t precision) {
+  if (value.isNegative()) {
+    std::cerr << "Error: square root of negative number!\n";
+    return Rational();
+  }
+
+  BigInteger scale(1);
+
+  for (size_t index = 0; index < precision % BigInteger::base_power; ++index) {
+    scale *= 10ll;
+  }
+
+  scale.shiftLimbs(precision / BigInteger::base_power);
+
+  BigInteger radicand(value.getNumerator() * scale * scale);
+  radicand /= value.getDenominator();
+  return Rational(radicand.isqrt()) / Rational(scale);
+}
+
+template <>
+struct std::hash<Rational> {
+  size_t operator()(const Rational& value) const {
+    return value.hash();
+  }
+};
+
+template <typename T>
+class HashedValue {
+private:
+  T value_;
+  size_t hash_;
+
+public:
+  explicit HashedValue(T value);
+
+  const T& value() const;
+
+  size_t hash() const;
+
+  friend bool operator==(const HashedValue& that, const HashedValue& other) {
+    return that.hash_ == other.hash_ && that.value_ == other.value_;
+  }
+
+  friend bool operator!=(const HashedValue& that, const HashedValue& other) {
+    return !(that == other);
+  }
+};
+
+template <typename T>
+HashedValue<T>::HashedValue(T value) : value_(std::move(value)), hash_(std::hash<T>()(value_)) {}
+
+template <typename T>
+const T& HashedValue<T>::value() const {
+  return value_;
+}
+
+template <typename T>
+size_t HashedValue<T>::hash() const {
+  return hash_;
+}
+
+template <typename T>
+struct std::hash<HashedValue<T>> {
+  size_t operator()(const HashedValue<T>& value) const {
+    return value.hash();
+  }
+};